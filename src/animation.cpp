@@ -1,5 +1,6 @@
 #include "animation.h"
 
+#include "animation_timeline.h"
 #include "avatar.h"
 #include "cached_options.h"
 #include "character.h"
@@ -13,6 +14,7 @@
 #include "memory_fast.h"
 #include "monster.h"
 #include "mtype.h"
+#include "optional.h"
 #include "options.h"
 #include "output.h"
 #include "point.h"
@@ -33,6 +35,7 @@
 #endif
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <iosfwd>
 #include <iterator>
@@ -46,11 +49,46 @@
 namespace
 {
 
+std::chrono::milliseconds animation_budget()
+{
+    return std::chrono::milliseconds( get_option<int>( "ANIMATION_TIME_LIMIT" ) );
+}
+
+animation_timeline &get_animation_timeline()
+{
+    static animation_timeline timeline( animation_budget() );
+    return timeline;
+}
+
+// Takes the input that arrived while an animation frame was shown, and puts it back for whatever
+// asks for input next. Returns whether there was a key press among it.
+bool forward_pending_input()
+{
+    std::vector<input_event> pending;
+    inp_mngr.set_timeout( 0 );
+    while( true ) {
+        const input_event event = inp_mngr.get_input_event();
+        if( event.type == input_event_t::error || event.type == input_event_t::timeout ) {
+            break;
+        }
+        pending.push_back( event );
+    }
+    inp_mngr.reset_timeout();
+    bool key_pressed = false;
+    for( const input_event &event : pending ) {
+        key_pressed |= event.type == input_event_t::keyboard_char ||
+                       event.type == input_event_t::keyboard_code ||
+                       event.type == input_event_t::gamepad;
+        inp_mngr.requeue_input_event( event );
+    }
+    return key_pressed;
+}
+
 class basic_animation
 {
     public:
         explicit basic_animation( const int scale ) :
-            delay( get_option<int>( "ANIMATION_DELAY" ) * scale * 1'000'000L ) {
+            delay( get_option<int>( "ANIMATION_DELAY" ) * scale ) {
         }
 
         void draw() const {
@@ -65,23 +103,37 @@ class basic_animation
         }
 
         void progress() const {
+            animation_timeline &timeline = get_animation_timeline();
+            const cata::optional<animation_timeline::clock::duration> shown =
+                timeline.frame_delay( animation_timeline::clock::now(), delay );
+            if( !shown ) {
+                return;
+            }
             draw();
 
+            // Sleep in coarse chunks, and look for input in between: any key skips the
+            // remaining animations. Everything that came in is put back, so it still goes to
+            // whatever asks for input next.
             // NOLINTNEXTLINE(cata-no-long): timespec uses long int
-            long int remain = delay;
-            while( remain > 0 ) {
+            long int remain =
+                std::chrono::duration_cast<std::chrono::nanoseconds>( *shown ).count();
+            do {
                 // NOLINTNEXTLINE(cata-no-long): timespec uses long int
                 long int do_sleep = std::min( remain, 100'000'000L );
-                timespec to_sleep = timespec { 0, do_sleep };
-                nanosleep( &to_sleep, nullptr );
-                inp_mngr.pump_events();
+                if( do_sleep > 0 ) {
+                    timespec to_sleep = timespec { 0, do_sleep };
+                    nanosleep( &to_sleep, nullptr );
+                }
                 remain -= do_sleep;
-            }
+                if( forward_pending_input() ) {
+                    timeline.skip();
+                    break;
+                }
+            } while( remain > 0 );
         }
 
     private:
-        // NOLINTNEXTLINE(cata-no-long): timespec uses long int
-        long int delay;
+        std::chrono::milliseconds delay;
 };
 
 class explosion_animation : public basic_animation
@@ -260,6 +312,13 @@ void draw_custom_explosion_curses( game &g,
 }
 } // namespace
 
+void reset_animation_timeline()
+{
+    animation_timeline &timeline = get_animation_timeline();
+    timeline.set_budget( animation_budget() );
+    timeline.reset();
+}
+
 #if defined(TILES)
 void explosion_handler::draw_explosion( const tripoint &p, const int r, const nc_color &col )
 {
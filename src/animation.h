@@ -34,4 +34,10 @@ struct explosion_tile {
     cata::optional<std::string> tile_name;
 };
 
+/**
+ * Starts a new timeline for the animation frames, called right before the game waits for the
+ * player's input. Until then, animations are shown within a limited real time budget only.
+ */
+void reset_animation_timeline();
+
 #endif // CATA_SRC_ANIMATION_H
@@ -0,0 +1,73 @@
+#pragma once
+#ifndef CATA_SRC_ANIMATION_TIMELINE_H
+#define CATA_SRC_ANIMATION_TIMELINE_H
+
+#include <chrono>
+
+#include "optional.h"
+
+/**
+ * Real time bookkeeping for the animation frames (bullets, explosions, spell areas) shown between
+ * two player inputs.
+ *
+ * Every frame asks for its delay, and gets back how long it may actually be shown. Frames are
+ * dropped entirely once the player skipped the animations with a key press, or once the
+ * animations since the last input took up the whole budget, so a burst of shots or a long
+ * auto-move through a fight can't stall the game for seconds.
+ */
+class animation_timeline
+{
+    public:
+        using clock = std::chrono::steady_clock;
+
+        explicit animation_timeline( const clock::duration &budget ) : budget( budget ) {
+        }
+
+        void set_budget( const clock::duration &new_budget ) {
+            budget = new_budget;
+        }
+
+        /** Starts a new timeline, called whenever the game waits for the player's input. */
+        void reset() {
+            started = false;
+            skipped = false;
+        }
+
+        /** Drops all further frames until the next @ref reset. */
+        void skip() {
+            skipped = true;
+        }
+
+        bool is_skipped() const {
+            return skipped;
+        }
+
+        /**
+         * Returns how long a frame requested at `now` which wants to be shown for `delay`
+         * may be shown, or an empty optional if it should not be drawn at all. Frames without
+         * delay are drawn as long as the timeline isn't skipped or out of budget.
+         * The budget is spent in real time, including the time it took to draw the frames.
+         */
+        cata::optional<clock::duration> frame_delay( const clock::time_point &now,
+                const clock::duration &delay ) {
+            if( skipped ) {
+                return cata::nullopt;
+            }
+            if( !started ) {
+                started = true;
+                start = now;
+            }
+            if( now - start + delay > budget ) {
+                return cata::nullopt;
+            }
+            return delay;
+        }
+
+    private:
+        clock::duration budget;
+        clock::time_point start;
+        bool started = false;
+        bool skipped = false;
+};
+
+#endif // CATA_SRC_ANIMATION_TIMELINE_H
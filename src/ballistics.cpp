@@ -193,10 +193,54 @@ projectile_attack_aim projectile_attack_roll( const dispersion_sources &dispersi
     return aim;
 }
 
+const std::vector<tripoint> &projectile_volley::clear_path( const map &here,
+        const tripoint &target )
+{
+    if( !shared ) {
+        single_path = here.find_clear_path( source, target );
+        return single_path;
+    }
+    const uint64_t generation = here.get_skew_vision_cache().get_generation();
+    cached_path &cached = clear_paths[target];
+    if( cached.path.empty() || cached.generation != generation ) {
+        cached.generation = generation;
+        cached.path = here.find_clear_path( source, target );
+    }
+    return cached.path;
+}
+
+projectile_volley::own_vehicle_tile projectile_volley::own_vehicle_at( const map &here,
+        const tripoint &p )
+{
+    if( in_veh == nullptr ) {
+        return { false, false };
+    }
+    const auto compute = [&]() {
+        own_vehicle_tile tile;
+        const optional_vpart_position vp = here.veh_at( p );
+        tile.part = veh_pointer_or_null( vp ) == in_veh;
+        tile.inside = tile.part && vp->is_inside();
+        return tile;
+    };
+    if( !shared ) {
+        return compute();
+    }
+    auto it = own_vehicle_tiles.find( p );
+    if( it == own_vehicle_tiles.end() ) {
+        it = own_vehicle_tiles.emplace( p, compute() ).first;
+    }
+    return it->second;
+}
+
 dealt_projectile_attack projectile_attack( const projectile &proj_arg, const tripoint &source,
         const tripoint &target_arg, const dispersion_sources &dispersion,
-        Creature *origin, const vehicle *in_veh )
+        Creature *origin, const vehicle *in_veh, projectile_volley *volley )
 {
+    projectile_volley single_shot( source, in_veh, /*shared=*/false );
+    if( volley == nullptr || !volley->fired_from( source, in_veh ) ) {
+        volley = &single_shot;
+    }
+
     const bool do_animation = get_option<bool>( "ANIMATION_PROJECTILES" );
 
     double range = rl_dist( source, target_arg );
@@ -279,7 +323,7 @@ dealt_projectile_attack projectile_attack( const projectile &proj_arg, const tri
         trajectory = line_to( source, target );
     } else {
         // Go around obstacles a little if we're on target.
-        trajectory = here.find_clear_path( source, target );
+        trajectory = volley->clear_path( here, target );
     }
 
     add_msg_debug( "missed_by_tiles: %.2f; missed_by: %.2f; target (orig/hit): %d,%d,%d/%d,%d,%d",
@@ -346,12 +390,9 @@ dealt_projectile_attack projectile_attack( const projectile &proj_arg, const tri
             }
         }
 
-        if( in_veh != nullptr ) {
-            const optional_vpart_position other = here.veh_at( tp );
-            if( in_veh == veh_pointer_or_null( other ) && other->is_inside() ) {
-                // Turret is on the roof and can't hit anything inside
-                continue;
-            }
+        if( volley->is_inside_own_vehicle( here, tp ) ) {
+            // Turret is on the roof and can't hit anything inside
+            continue;
         }
 
         Creature *critter = g->critter_at( tp );
@@ -387,8 +428,7 @@ dealt_projectile_attack projectile_attack( const projectile &proj_arg, const tri
         }
 
         if( critter != nullptr && cur_missed_by < 1.0 ) {
-            if( in_veh != nullptr && veh_pointer_or_null( here.veh_at( tp ) ) == in_veh &&
-                critter->is_player() ) {
+            if( volley->is_own_vehicle( here, tp ) && critter->is_player() ) {
                 // Turret either was aimed by the player (who is now ducking) and shoots from above
                 // Or was just IFFing, giving lots of warnings and time to get out of the line of fire
                 continue;
@@ -408,7 +448,7 @@ dealt_projectile_attack projectile_attack( const projectile &proj_arg, const tri
             } else {
                 attack.missed_by = aim.missed_by;
             }
-        } else if( in_veh != nullptr && veh_pointer_or_null( here.veh_at( tp ) ) == in_veh ) {
+        } else if( volley->is_own_vehicle( here, tp ) ) {
             // Don't do anything, especially don't call map::shoot as this would damage the vehicle
         } else {
             here.shoot( tp, proj, !no_item_damage && tp == target );
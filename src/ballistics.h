@@ -2,12 +2,18 @@
 #ifndef CATA_SRC_BALLISTICS_H
 #define CATA_SRC_BALLISTICS_H
 
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "point.h"
+
 class Creature;
 class dispersion_sources;
+class map;
 class vehicle;
 struct dealt_projectile_attack;
 struct projectile;
-struct tripoint;
 
 /** Aim result for a single projectile attack */
 struct projectile_attack_aim {
@@ -25,13 +31,80 @@ struct projectile_attack_aim {
 projectile_attack_aim projectile_attack_roll( const dispersion_sources &dispersion, double range,
         double target_size );
 
+/**
+ * The parts of the trajectory which are the same for all projectiles of a volley (a burst, or
+ * the shots of a turret), computed by the first projectile and reused by the rest.
+ * All projectiles of a volley leave at once, so they share the path chosen around obstacles
+ * towards the target, and which tiles belong to the vehicle the volley is fired from.
+ * Creatures, terrain and floors are still checked by every projectile, as earlier
+ * projectiles can kill, move or destroy them.
+ */
+class projectile_volley
+{
+    public:
+        /**
+         * A volley that isn't `shared` is used by a single projectile only, so it doesn't
+         * remember anything that projectile computes.
+         */
+        projectile_volley( const tripoint &source, const vehicle *in_veh, bool shared = true ) :
+            source( source ), in_veh( in_veh ), shared( shared ) {
+        }
+
+        /** Whether projectiles from `source` fired from `in_veh` can use this volley. */
+        bool fired_from( const tripoint &source, const vehicle *in_veh ) const {
+            return this->source == source && this->in_veh == in_veh;
+        }
+
+        /**
+         * @ref map::find_clear_path from the source to `target`. That works on the cached
+         * transparency of the map, so terrain broken by an earlier projectile only changes the
+         * path once the map caches are rebuilt. The cached path is dropped at that point too,
+         * so it always matches what find_clear_path would return for the current projectile.
+         */
+        const std::vector<tripoint> &clear_path( const map &here, const tripoint &target );
+
+        /** Whether `p` is a part of the vehicle the volley is fired from. */
+        bool is_own_vehicle( const map &here, const tripoint &p ) {
+            return own_vehicle_at( here, p ).part;
+        }
+
+        /** Whether `p` is an inside part of the vehicle the volley is fired from. */
+        bool is_inside_own_vehicle( const map &here, const tripoint &p ) {
+            return own_vehicle_at( here, p ).inside;
+        }
+
+    private:
+        struct cached_path {
+            // see los_cache::get_generation
+            uint64_t generation = 0;
+            std::vector<tripoint> path;
+        };
+
+        struct own_vehicle_tile {
+            bool part = false;
+            bool inside = false;
+        };
+
+        own_vehicle_tile own_vehicle_at( const map &here, const tripoint &p );
+
+        tripoint source;
+        const vehicle *in_veh;
+        bool shared;
+        // the path of a volley that isn't shared
+        std::vector<tripoint> single_path;
+        std::unordered_map<tripoint, cached_path> clear_paths;
+        std::unordered_map<tripoint, own_vehicle_tile> own_vehicle_tiles;
+};
+
 /**
  *  Fires a projectile at the target point from the source point with total_dispersion
  *  dispersion.
  *  Returns the rolled dispersion of the shot and the actually hit point.
+ *  Projectiles fired together should share a @ref projectile_volley.
  */
 dealt_projectile_attack projectile_attack( const projectile &proj_arg, const tripoint &source,
         const tripoint &target_arg, const dispersion_sources &dispersion,
-        Creature *origin = nullptr, const vehicle *in_veh = nullptr );
+        Creature *origin = nullptr, const vehicle *in_veh = nullptr,
+        projectile_volley *volley = nullptr );
 
 #endif // CATA_SRC_BALLISTICS_H
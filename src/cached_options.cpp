@@ -2,6 +2,7 @@
 
 bool fov_3d;
 int fov_3d_z_range;
+bool viewer_fov_cache;
 bool keycode_mode;
 bool log_from_top;
 int message_ttl;
@@ -8,6 +8,7 @@
 
 extern bool fov_3d;
 extern int fov_3d_z_range;
+extern bool viewer_fov_cache;
 extern bool keycode_mode;
 extern bool log_from_top;
 extern int message_ttl;
@@ -287,7 +287,7 @@ tile_type &tileset::create_tile_type( const std::string &id, tile_type &&new_til
 }
 
 void cata_tiles::load_tileset( const std::string &tileset_id, const bool precheck,
-                               const bool force, const bool pump_events )
+                               const bool force, const bool pump_events, const bool stream )
 {
     if( tileset_ptr && tileset_ptr->get_tileset_id() == tileset_id && !force ) {
         return;
@@ -295,19 +295,43 @@ void cata_tiles::load_tileset( const std::string &tileset_id, const bool prechec
     // TODO: move into clear or somewhere else.
     // reset the overlay ordering from the previous loaded tileset
     tileset_mutation_overlay_ordering.clear();
+    // don't keep streaming the previous tileset while loading the new one
+    tileset_streamer.reset();
 
     // Load the tileset into a separate instance and only set this->tileset_ptr
     // when the loading has succeeded.
     std::unique_ptr<tileset> new_tileset_ptr = std::make_unique<tileset>();
-    tileset_loader loader( *new_tileset_ptr, renderer );
-    loader.load( tileset_id, precheck, /*pump_events=*/pump_events );
+    std::unique_ptr<tileset_loader> loader = std::make_unique<tileset_loader>( *new_tileset_ptr,
+            renderer );
+    loader->load( tileset_id, precheck, /*pump_events=*/pump_events, /*stream=*/stream );
     tileset_ptr = std::move( new_tileset_ptr );
+    if( !loader->done() ) {
+        // the loader refers to the tileset, which keeps its address when moved into tileset_ptr
+        tileset_streamer = std::move( loader );
+    }
 
     set_draw_scale( 16 );
 
     minimap->set_type( tile_iso ? pixel_minimap_type::iso : pixel_minimap_type::ortho );
 }
 
+bool cata_tiles::continue_tileset_loading()
+{
+    if( !tileset_streamer ) {
+        return false;
+    }
+    try {
+        if( tileset_streamer->load_next_chunk() && !tileset_streamer->done() ) {
+            return true;
+        }
+    } catch( const std::exception &err ) {
+        // the sprites that were not loaded stay placeholders
+        dbg( D_ERROR ) << "failed to stream tileset: " << err.what();
+    }
+    tileset_streamer.reset();
+    return true;
+}
+
 void cata_tiles::reinit()
 {
     set_draw_scale( 16 );
@@ -358,14 +382,16 @@ static void get_tile_information( const std::string &config_path, std::string &j
     }
 }
 
+// Returns a copy of the `src` rectangle of `original` with `pixel_converter` applied to it.
 template<typename PixelConverter>
-static SDL_Surface_Ptr apply_color_filter( const SDL_Surface_Ptr &original,
+static SDL_Surface_Ptr apply_color_filter( const SDL_Surface_Ptr &original, const SDL_Rect &src,
         PixelConverter pixel_converter )
 {
     cata_assert( original );
-    SDL_Surface_Ptr surf = create_surface_32( original->w, original->h );
+    SDL_Surface_Ptr surf = create_surface_32( src.w, src.h );
     cata_assert( surf );
-    throwErrorIf( SDL_BlitSurface( original.get(), nullptr, surf.get(), nullptr ) != 0,
+    SDL_Rect src_rect = src;
+    throwErrorIf( SDL_BlitSurface( original.get(), &src_rect, surf.get(), nullptr ) != 0,
                   "SDL_BlitSurface failed" );
 
     SDL_Color *pix = static_cast<SDL_Color *>( surf->pixels );
@@ -421,28 +447,100 @@ void tileset_loader::create_textures_from_tile_atlas( const SDL_Surface_Ptr &til
         const point &offset )
 {
     cata_assert( tile_atlas );
+    // Only the unfiltered sprites are uploaded here, the color filtered variants are
+    // created on demand by tileset::get_variant_tile.
+    copy_surface_to_texture( tile_atlas, offset, ts.tile_values );
+}
+
+// Decodes a tile atlas image, with black as the transparent color if color_key is set.
+static SDL_Surface_Ptr decode_atlas_image( const std::string &path, const bool color_key )
+{
+    SDL_Surface_Ptr tile_atlas = load_image( path.c_str() );
+    cata_assert( tile_atlas );
 
-    /** perform color filter conversion here */
-    using tiles_pixel_color_entry = std::tuple<std::vector<texture>*, std::string>;
-    std::array<tiles_pixel_color_entry, 5> tile_values_data = {{
-            { std::make_tuple( &ts.tile_values, "color_pixel_none" ) },
-            { std::make_tuple( &ts.shadow_tile_values, "color_pixel_grayscale" ) },
-            { std::make_tuple( &ts.night_tile_values, "color_pixel_nightvision" ) },
-            { std::make_tuple( &ts.overexposed_tile_values, "color_pixel_overexposed" ) },
-            { std::make_tuple( &ts.memory_tile_values, tilecontext->memory_map_mode ) }
+    if( color_key ) {
+        const Uint32 key = SDL_MapRGB( tile_atlas->format, 0, 0, 0 );
+        throwErrorIf( SDL_SetColorKey( tile_atlas.get(), SDL_TRUE, key ) != 0,
+                      "SDL_SetColorKey failed" );
+        throwErrorIf( SDL_SetSurfaceRLE( tile_atlas.get(), 1 ), "SDL_SetSurfaceRLE failed" );
+    }
+    return tile_atlas;
+}
+
+const texture *tileset::get_variant_tile( const size_t index, const tile_variant variant ) const
+{
+    if( index >= sprite_sources.size() || sprite_sources[index].atlas < 0 ) {
+        // not loaded from an atlas
+        return nullptr;
+    }
+    const color_pixel_function_pointer filter = variant_filters[static_cast<size_t>( variant )];
+    if( !filter ) {
+        return get_tile( index );
+    }
+    std::vector<texture> &values = variant_values[static_cast<size_t>( variant )];
+    if( values.size() < sprite_sources.size() ) {
+        values.resize( sprite_sources.size() );
+    }
+    atlas_source &atlas = atlases[sprite_sources[index].atlas];
+    if( !atlas.variant_built[static_cast<size_t>( variant )] ) {
+        if( !atlas.surface && !atlas.uploaded ) {
+            // the atlas is still waiting to be streamed in
+            return nullptr;
         }
-    };
-    for( tiles_pixel_color_entry &entry : tile_values_data ) {
-        std::vector<texture> *tile_values = std::get<0>( entry );
-        color_pixel_function_pointer color_pixel_function = get_color_pixel_function( std::get<1>
-                ( entry ) );
-        if( !color_pixel_function ) {
-            // TODO: Move it inside apply_color_filter.
-            copy_surface_to_texture( tile_atlas, offset, *tile_values );
-        } else {
-            copy_surface_to_texture( apply_color_filter( tile_atlas, color_pixel_function ), offset,
-                                     *tile_values );
+        build_variant( atlas, variant );
+    }
+    return &values[index];
+}
+
+void tileset::build_variant( atlas_source &atlas, const tile_variant variant ) const
+{
+    cata_assert( renderer );
+    if( !atlas.surface ) {
+        atlas.surface = decode_atlas_image( atlas.path, atlas.color_key );
+    }
+    const color_pixel_function_pointer filter = variant_filters[static_cast<size_t>( variant )];
+    std::vector<texture> &values = variant_values[static_cast<size_t>( variant )];
+    const SDL_Surface_Ptr &surf = atlas.surface;
+    cata_assert( !atlas.parts.empty() );
+
+    // The parts are a grid of equally sized rectangles over the atlas.
+    const int part_w = atlas.parts.front().w;
+    const int part_h = atlas.parts.front().h;
+    int part_columns = 0;
+    for( const SDL_Rect &part : atlas.parts ) {
+        part_columns = std::max( part_columns, part.x / part_w + 1 );
+    }
+    std::vector<std::shared_ptr<SDL_Texture>> part_textures( atlas.parts.size() );
+    for( const SDL_Rect &part : atlas.parts ) {
+        // Filter the part of the atlas that is inside of it, like the unfiltered upload does.
+        const SDL_Rect inp{ part.x, part.y, std::min( surf->w - part.x, part.w ),
+                            std::min( surf->h - part.y, part.h ) };
+        const size_t part_index = ( part.y / part_h ) * part_columns + part.x / part_w;
+        cata_assert( part_index < part_textures.size() );
+        part_textures[part_index] = CreateTextureFromSurface( *renderer,
+                                    apply_color_filter( surf, inp, filter ) );
+        cata_assert( part_textures[part_index] );
+    }
+    for( int i = atlas.first_sprite; i < atlas.first_sprite + atlas.sprite_count; ++i ) {
+        const SDL_Rect &rect = sprite_sources[i].rect;
+        const point part( rect.x / part_w, rect.y / part_h );
+        const size_t part_index = part.y * part_columns + part.x;
+        if( part.x >= part_columns || part_index >= part_textures.size() ) {
+            // not covered by any part, so it has no unfiltered texture either
+            continue;
         }
+        values[i] = texture( part_textures[part_index],
+                             SDL_Rect{ rect.x - part.x * part_w, rect.y - part.y * part_h,
+                                       rect.w, rect.h } );
+    }
+    atlas.variant_built[static_cast<size_t>( variant )] = true;
+    release_if_done( atlas );
+}
+
+void tileset::release_if_done( atlas_source &atlas ) const
+{
+    if( atlas.uploaded ) {
+        atlas.surface.reset();
     }
 }
 
@@ -452,19 +550,47 @@ static void extend_vector_by( std::vector<T> &vec, const size_t additional_size
     vec.resize( vec.size() + additional_size );
 }
 
-void tileset_loader::load_tileset( const std::string &img_path, const bool pump_events )
+// Reads the image size from the header of a PNG file, without decoding the image.
+static bool read_png_size( const std::string &path, point &size )
 {
-    const SDL_Surface_Ptr tile_atlas = load_image( img_path.c_str() );
-    cata_assert( tile_atlas );
-    tile_atlas_width = tile_atlas->w;
-
-    if( R >= 0 && R <= 255 && G >= 0 && G <= 255 && B >= 0 && B <= 255 ) {
-        const Uint32 key = SDL_MapRGB( tile_atlas->format, 0, 0, 0 );
-        throwErrorIf( SDL_SetColorKey( tile_atlas.get(), SDL_TRUE, key ) != 0,
-                      "SDL_SetColorKey failed" );
-        throwErrorIf( SDL_SetSurfaceRLE( tile_atlas.get(), 1 ), "SDL_SetSurfaceRLE failed" );
+    std::ifstream fin( path.c_str(), std::ifstream::in | std::ifstream::binary );
+    // 8 byte signature, then the IHDR chunk: 4 byte length, "IHDR", 4 byte width, 4 byte height
+    std::array<unsigned char, 24> header;
+    if( !fin.read( reinterpret_cast<char *>( header.data() ), header.size() ) ) {
+        return false;
+    }
+    static const std::array<unsigned char, 8> signature = {
+        { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' }
+    };
+    if( !std::equal( signature.begin(), signature.end(), header.begin() ) ||
+        std::string( header.begin() + 12, header.begin() + 16 ) != "IHDR" ) {
+        return false;
     }
+    const auto read_u32 = [&]( size_t pos ) {
+        return static_cast<int>( static_cast<uint32_t>( header[pos] ) << 24 |
+                                 static_cast<uint32_t>( header[pos + 1] ) << 16 |
+                                 static_cast<uint32_t>( header[pos + 2] ) << 8 | header[pos + 3] );
+    };
+    size = point( read_u32( 16 ), read_u32( 20 ) );
+    return size.x > 0 && size.y > 0;
+}
+
+void tileset_loader::use_atlas_geometry( const pending_atlas &atlas )
+{
+    sprite_width = atlas.sprite_width;
+    sprite_height = atlas.sprite_height;
+    offset = atlas.offset;
+    tile_atlas_width = atlas.width;
+}
+
+SDL_Surface_Ptr tileset_loader::decode_atlas( const pending_atlas &atlas )
+{
+    const tileset::atlas_source &source = ts.atlases[atlas.atlas];
+    return decode_atlas_image( source.path, source.color_key );
+}
 
+std::vector<SDL_Rect> tileset_loader::atlas_parts( const SDL_Surface_Ptr &tile_atlas )
+{
     SDL_RendererInfo info;
     throwErrorIf( SDL_GetRendererInfo( renderer.get(), &info ) != 0, "SDL_GetRendererInfo failed" );
     // Software rendering stores textures as surfaces with run-length encoding, which makes
@@ -516,46 +642,122 @@ void tileset_loader::load_tileset( const std::string &img_path, const bool pump_
         max_tile_ycount * sprite_height,
         point( divide_round_up( tile_atlas->w, info.max_texture_width ),
                divide_round_up( tile_atlas->h, info.max_texture_height ) ) );
+    std::vector<SDL_Rect> parts;
+    for( const SDL_Rect sub_rect : output_range ) {
+        parts.push_back( sub_rect );
+    }
+    return parts;
+}
 
-    const int expected_tilecount = ( tile_atlas->w / sprite_width ) *
-                                   ( tile_atlas->h / sprite_height );
+void tileset_loader::upload_atlas_part( const SDL_Surface_Ptr &tile_atlas,
+                                        const SDL_Rect &sub_rect )
+{
+    cata_assert( sub_rect.x % sprite_width == 0 );
+    cata_assert( sub_rect.y % sprite_height == 0 );
+    cata_assert( sub_rect.w % sprite_width == 0 );
+    cata_assert( sub_rect.h % sprite_height == 0 );
+    SDL_Surface_Ptr smaller_surf;
+
+    if( is_contained( SDL_Rect{ 0, 0, tile_atlas->w, tile_atlas->h }, sub_rect ) ) {
+        // can use tile_atlas directly, it is completely contained in the output rectangle
+    } else {
+        // Need a temporary surface that contains the parts of the tile atlas that fit
+        // into sub_rect. But doesn't always need to be as large as sub_rect.
+        const int w = std::min( tile_atlas->w - sub_rect.x, sub_rect.w );
+        const int h = std::min( tile_atlas->h - sub_rect.y, sub_rect.h );
+        smaller_surf = ::create_surface_32( w, h );
+        cata_assert( smaller_surf );
+        const SDL_Rect inp{ sub_rect.x, sub_rect.y, w, h };
+        throwErrorIf( SDL_BlitSurface( tile_atlas.get(), &inp, smaller_surf.get(),
+                                       nullptr ) != 0, "SDL_BlitSurface failed" );
+    }
+    const SDL_Surface_Ptr &surf_to_use = smaller_surf ? smaller_surf : tile_atlas;
+    cata_assert( surf_to_use );
+
+    create_textures_from_tile_atlas( surf_to_use, point( sub_rect.x, sub_rect.y ) );
+}
+
+void tileset_loader::load_tileset( const std::string &img_path, const bool pump_events,
+                                   const bool stream )
+{
+    pending_atlas atlas;
+    atlas.sprite_width = sprite_width;
+    atlas.sprite_height = sprite_height;
+    atlas.offset = offset;
+    atlas.atlas = ts.atlases.size();
+    // its image is filled in once decoded
+    ts.atlases.emplace_back();
+    ts.atlases.back().first_sprite = offset;
+    ts.atlases.back().path = img_path;
+    ts.atlases.back().color_key = R >= 0 && R <= 255 && G >= 0 && G <= 255 && B >= 0 && B <= 255;
+
+    SDL_Surface_Ptr tile_atlas;
+    point atlas_size;
+    if( !stream || !read_png_size( img_path, atlas_size ) ) {
+        tile_atlas = decode_atlas( atlas );
+        atlas_size = point( tile_atlas->w, tile_atlas->h );
+    }
+    atlas.width = atlas_size.x;
+    tile_atlas_width = atlas_size.x;
+
+    const int expected_tilecount = ( atlas_size.x / sprite_width ) *
+                                   ( atlas_size.y / sprite_height );
     extend_vector_by( ts.tile_values, expected_tilecount );
-    extend_vector_by( ts.shadow_tile_values, expected_tilecount );
-    extend_vector_by( ts.night_tile_values, expected_tilecount );
-    extend_vector_by( ts.overexposed_tile_values, expected_tilecount );
-    extend_vector_by( ts.memory_tile_values, expected_tilecount );
 
-    for( const SDL_Rect sub_rect : output_range ) {
-        cata_assert( sub_rect.x % sprite_width == 0 );
-        cata_assert( sub_rect.y % sprite_height == 0 );
-        cata_assert( sub_rect.w % sprite_width == 0 );
-        cata_assert( sub_rect.h % sprite_height == 0 );
-        SDL_Surface_Ptr smaller_surf;
-
-        if( is_contained( SDL_Rect{ 0, 0, tile_atlas->w, tile_atlas->h }, sub_rect ) ) {
-            // can use tile_atlas directly, it is completely contained in the output rectangle
-        } else {
-            // Need a temporary surface that contains the parts of the tile atlas that fit
-            // into sub_rect. But doesn't always need to be as large as sub_rect.
-            const int w = std::min( tile_atlas->w - sub_rect.x, sub_rect.w );
-            const int h = std::min( tile_atlas->h - sub_rect.y, sub_rect.h );
-            smaller_surf = ::create_surface_32( w, h );
-            cata_assert( smaller_surf );
-            const SDL_Rect inp{ sub_rect.x, sub_rect.y, w, h };
-            throwErrorIf( SDL_BlitSurface( tile_atlas.get(), &inp, smaller_surf.get(),
-                                           nullptr ) != 0, "SDL_BlitSurface failed" );
-        }
-        const SDL_Surface_Ptr &surf_to_use = smaller_surf ? smaller_surf : tile_atlas;
-        cata_assert( surf_to_use );
+    // Remember where each sprite is, so its color filtered variants can be made later on.
+    ts.sprite_sources.resize( ts.tile_values.size() );
+    const int atlas_columns = atlas_size.x / sprite_width;
+    for( int i = 0; i < expected_tilecount; ++i ) {
+        tileset::sprite_source &source = ts.sprite_sources[offset + i];
+        source.atlas = atlas.atlas;
+        source.rect = SDL_Rect{ ( i % atlas_columns ) * sprite_width,
+                                ( i / atlas_columns ) * sprite_height,
+                                sprite_width, sprite_height };
+    }
+    size = expected_tilecount;
+    ts.atlases[atlas.atlas].sprite_count = expected_tilecount;
 
-        create_textures_from_tile_atlas( surf_to_use, point( sub_rect.x, sub_rect.y ) );
+    if( !tile_atlas ) {
+        pending_atlases.push_back( atlas );
+        return;
+    }
+    tileset::atlas_source &source = ts.atlases[atlas.atlas];
+    source.parts = atlas_parts( tile_atlas );
+    for( const SDL_Rect &sub_rect : source.parts ) {
+        upload_atlas_part( tile_atlas, sub_rect );
 
         if( pump_events ) {
             inp_mngr.pump_events();
         }
     }
+    source.surface = std::move( tile_atlas );
+    source.uploaded = true;
+    ts.release_if_done( source );
+}
 
-    size = expected_tilecount;
+bool tileset_loader::load_next_chunk()
+{
+    if( pending_atlases.empty() ) {
+        return false;
+    }
+    pending_atlas &atlas = pending_atlases.front();
+    use_atlas_geometry( atlas );
+    tileset::atlas_source &source = ts.atlases[atlas.atlas];
+    if( !source.surface ) {
+        source.surface = decode_atlas( atlas );
+        source.parts = atlas_parts( source.surface );
+        atlas.parts = source.parts;
+    } else {
+        upload_atlas_part( source.surface, atlas.parts.back() );
+        atlas.parts.pop_back();
+    }
+    if( atlas.parts.empty() ) {
+        source.uploaded = true;
+        ts.release_if_done( source );
+        pending_atlases.pop_front();
+        ts.streaming = !pending_atlases.empty();
+    }
+    return true;
 }
 
 void cata_tiles::set_draw_scale( int scale )
@@ -569,7 +771,7 @@ void cata_tiles::set_draw_scale( int scale )
 }
 
 void tileset_loader::load( const std::string &tileset_id, const bool precheck,
-                           const bool pump_events )
+                           const bool pump_events, const bool stream )
 {
     std::string json_conf;
     std::string tileset_path;
@@ -620,9 +822,20 @@ void tileset_loader::load( const std::string &tileset_id, const bool precheck,
         return;
     }
 
+    // The color filters of the sprite variants, applied when a variant is first drawn.
+    const auto set_variant_filter = [&]( tileset::tile_variant variant, const std::string & name ) {
+        ts.variant_filters[static_cast<size_t>( variant )] = get_color_pixel_function( name );
+    };
+    set_variant_filter( tileset::tile_variant::shadow, "color_pixel_grayscale" );
+    set_variant_filter( tileset::tile_variant::night, "color_pixel_nightvision" );
+    set_variant_filter( tileset::tile_variant::overexposed, "color_pixel_overexposed" );
+    set_variant_filter( tileset::tile_variant::memory,
+                        tilecontext ? tilecontext->memory_map_mode :
+                        get_option<std::string>( "MEMORY_MAP_MODE" ) );
+
     // Load tile information if available.
     offset = 0;
-    load_internal( config, tileset_root, img_path, pump_events );
+    load_internal( config, tileset_root, img_path, pump_events, stream );
 
     // Load mod tilesets if available
     for( const mod_tileset &mts : all_mod_tilesets ) {
@@ -661,7 +874,7 @@ void tileset_loader::load( const std::string &tileset_id, const bool precheck,
                         if( mod_config.has_member( "compatibility" ) ) {
                             mod_config.get_member( "compatibility" );
                         }
-                        load_internal( mod_config, tileset_root, img_path, pump_events );
+                        load_internal( mod_config, tileset_root, img_path, pump_events, stream );
                         break;
                     }
                     num_in_file++;
@@ -670,7 +883,7 @@ void tileset_loader::load( const std::string &tileset_id, const bool precheck,
         } else {
             JsonObject mod_config = mod_config_json.get_object();
             mark_visited( mod_config );
-            load_internal( mod_config, tileset_root, img_path, pump_events );
+            load_internal( mod_config, tileset_root, img_path, pump_events, stream );
         }
     }
 
@@ -693,12 +906,17 @@ void tileset_loader::load( const std::string &tileset_id, const bool precheck,
         dbg( D_ERROR ) << "The tileset you're using has no 'unknown' tile defined!";
     }
     ensure_default_item_highlight();
+    if( !pending_atlases.empty() ) {
+        create_placeholder();
+        ts.streaming = true;
+    }
 
     ts.tileset_id = tileset_id;
 }
 
 void tileset_loader::load_internal( const JsonObject &config, const std::string &tileset_root,
-                                    const std::string &img_path, const bool pump_events )
+                                    const std::string &img_path, const bool pump_events,
+                                    const bool stream )
 {
     if( config.has_array( "tiles-new" ) ) {
         // new system, several entries
@@ -723,7 +941,7 @@ void tileset_loader::load_internal( const JsonObject &config, const std::string
             sprite_offset.y = tile_part_def.get_int( "sprite_offset_y", 0 );
             // First load the tileset image to get the number of available tiles.
             dbg( D_INFO ) << "Attempting to Load Tileset file " << tileset_image_path;
-            load_tileset( tileset_image_path, pump_events );
+            load_tileset( tileset_image_path, pump_events, stream );
             load_tilejson_from_file( tile_part_def );
             if( tile_part_def.has_member( "ascii" ) ) {
                 load_ascii( tile_part_def );
@@ -744,7 +962,7 @@ void tileset_loader::load_internal( const JsonObject &config, const std::string
         B = -1;
         // old system, no tile file path entry, only one array of tiles
         dbg( D_INFO ) << "Attempting to Load Tileset file " << img_path;
-        load_tileset( img_path, pump_events );
+        load_tileset( img_path, pump_events, stream );
         load_tilejson_from_file( config );
         offset = size;
     }
@@ -1115,7 +1333,7 @@ void cata_tiles::draw( const point &dest, const tripoint &center, int width, int
     const int max_visible_x = ( you.posx() % SEEX ) + ( MAPSIZE - 1 ) * SEEX;
     const int max_visible_y = ( you.posy() % SEEY ) + ( MAPSIZE - 1 ) * SEEY;
 
-    const level_cache &ch = here.access_cache( center.z );
+    const level_cache &ch = static_cast<const map &>( here ).access_cache( center.z );
 
     // Map memory should be at least the size of the view range
     // so that new tiles can be memorized, and at least the size of the display
@@ -3136,6 +3354,16 @@ void tileset_loader::ensure_default_item_highlight()
     ts.tile_ids[ITEM_HIGHLIGHT].fg.add( std::vector<int>( {index} ), 1 );
 }
 
+void tileset_loader::create_placeholder()
+{
+    const SDL_Surface_Ptr surface = create_surface_32( ts.tile_width, ts.tile_height );
+    cata_assert( surface );
+    throwErrorIf( SDL_FillRect( surface.get(), nullptr, SDL_MapRGBA( surface->format, 64, 64, 64,
+                                127 ) ) != 0, "SDL_FillRect failed" );
+    ts.placeholder = texture( CreateTextureFromSurface( renderer, surface ),
+                              SDL_Rect{ 0, 0, ts.tile_width, ts.tile_height } );
+}
+
 /* Animation Functions */
 /* -- Inits */
 void cata_tiles::init_explosion( const tripoint &p, int radius )
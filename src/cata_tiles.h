@@ -2,7 +2,9 @@
 #ifndef CATA_SRC_CATA_TILES_H
 #define CATA_SRC_CATA_TILES_H
 
+#include <array>
 #include <cstddef>
+#include <deque>
 #include <map>
 #include <memory>
 #include <string>
@@ -22,6 +24,7 @@
 #include "point.h"
 #include "sdl_wrappers.h"
 #include "sdl_geometry.h"
+#include "sdl_utils.h"
 #include "type_id.h"
 #include "weather.h"
 #include "weighted_list.h"
@@ -130,11 +133,57 @@ class tileset
         // multiplier for pixel-doubling tilesets
         float tile_pixelscale = 1.0f;
 
+        /** Color filtered variants of the sprites, see @ref get_variant_tile. */
+        enum class tile_variant : int {
+            shadow,
+            night,
+            overexposed,
+            memory,
+            num_variants
+        };
+        static constexpr size_t num_variants = static_cast<size_t>( tile_variant::num_variants );
+
+        /** Where a sprite was loaded from: index into @ref atlases and the rectangle in it. */
+        struct sprite_source {
+            int atlas = -1;
+            SDL_Rect rect = { 0, 0, 0, 0 };
+        };
+
+        /**
+         * A tile atlas. It is only kept decoded while it is being uploaded, building a color
+         * filtered variant of it later on decodes the image file again.
+         */
+        struct atlas_source {
+            // the image file and whether black is transparent in it
+            std::string path;
+            bool color_key = false;
+            // nullptr unless decoded
+            SDL_Surface_Ptr surface;
+            // parts of the atlas that each fit into a single texture, see tileset_loader::atlas_parts
+            std::vector<SDL_Rect> parts;
+            // the sprites of the atlas, [first_sprite, first_sprite + sprite_count)
+            int first_sprite = 0;
+            int sprite_count = 0;
+            // whether all its unfiltered sprites are uploaded
+            bool uploaded = false;
+            std::array<bool, num_variants> variant_built = {};
+        };
+
         std::vector<texture> tile_values;
-        std::vector<texture> shadow_tile_values;
-        std::vector<texture> night_tile_values;
-        std::vector<texture> overexposed_tile_values;
-        std::vector<texture> memory_tile_values;
+
+        // The tile atlases and the location of every sprite in them. The color filtered variants
+        // of an atlas are built the first time one of its sprites is drawn with that filter, into
+        // textures shared by all its sprites like the unfiltered ones.
+        const SDL_Renderer_Ptr *renderer = nullptr;
+        mutable std::vector<atlas_source> atlases;
+        std::vector<sprite_source> sprite_sources;
+        std::array<color_pixel_function_pointer, num_variants> variant_filters = {};
+        mutable std::array<std::vector<texture>, num_variants> variant_values;
+
+        // Set while some atlases are still being streamed in (see @ref tileset_loader::load),
+        // sprites that are not uploaded yet are drawn as the placeholder.
+        bool streaming = false;
+        texture placeholder;
 
         std::unordered_map<std::string, tile_type> tile_ids;
         // caches both "default" and "_season_XXX" tile variants (to reduce the number of lookups)
@@ -142,10 +191,23 @@ class tileset
         std::unordered_map<std::string, season_tile_value> tile_ids_by_season[season_type::NUM_SEASONS];
 
         static const texture *get_if_available( const size_t index,
-                                                const decltype( shadow_tile_values ) &tiles ) {
+                                                const decltype( tile_values ) &tiles ) {
             return index < tiles.size() ? & tiles[index] : nullptr;
         }
 
+        /**
+         * Returns the variant of sprite `index`, creating it from its atlas on first use.
+         * Returns nullptr if the sprite has no such variant (e.g. it wasn't loaded from an atlas).
+         */
+        const texture *get_variant_tile( size_t index, tile_variant variant ) const;
+        /**
+         * Builds the variant of every sprite of the atlas, decoding the atlas again if needed,
+         * and drops the decoded atlas afterwards if it's uploaded.
+         */
+        void build_variant( atlas_source &atlas, tile_variant variant ) const;
+        /** Drops the decoded atlas once all its unfiltered sprites are uploaded. */
+        void release_if_done( atlas_source &atlas ) const;
+
         friend class tileset_loader;
 
     public:
@@ -163,19 +225,26 @@ class tileset
         }
 
         const texture *get_tile( const size_t index ) const {
-            return get_if_available( index, tile_values );
+            const texture *tex = get_if_available( index, tile_values );
+            if( streaming && tex && tex->dimension() == std::make_pair( 0, 0 ) ) {
+                return &placeholder;
+            }
+            return tex;
+        }
+        size_t get_sprite_count() const {
+            return tile_values.size();
         }
         const texture *get_night_tile( const size_t index ) const {
-            return get_if_available( index, night_tile_values );
+            return get_variant_tile( index, tile_variant::night );
         }
         const texture *get_shadow_tile( const size_t index ) const {
-            return get_if_available( index, shadow_tile_values );
+            return get_variant_tile( index, tile_variant::shadow );
         }
         const texture *get_overexposed_tile( const size_t index ) const {
-            return get_if_available( index, overexposed_tile_values );
+            return get_variant_tile( index, tile_variant::overexposed );
         }
         const texture *get_memory_tile( const size_t index ) const {
-            return get_if_available( index, memory_tile_values );
+            return get_variant_tile( index, tile_variant::memory );
         }
 
         tile_type &create_tile_type( const std::string &id, tile_type &&new_tile_type );
@@ -220,7 +289,28 @@ class tileset_loader
 
         int tile_atlas_width = 0;
 
+        /** A tile atlas whose sprites have been indexed, but which is not decoded or uploaded yet. */
+        struct pending_atlas {
+            int sprite_width = 0;
+            int sprite_height = 0;
+            int offset = 0;
+            int width = 0;
+            // index into tileset::atlases
+            int atlas = 0;
+            // parts of the decoded atlas that still need to be uploaded
+            std::vector<SDL_Rect> parts;
+        };
+        std::deque<pending_atlas> pending_atlases;
+
         void ensure_default_item_highlight();
+        void create_placeholder();
+
+        /** Sets the sprite geometry used by @ref copy_surface_to_texture to that of the atlas. */
+        void use_atlas_geometry( const pending_atlas &atlas );
+        SDL_Surface_Ptr decode_atlas( const pending_atlas &atlas );
+        /** Splits the atlas into parts that each fit into a single texture. */
+        std::vector<SDL_Rect> atlas_parts( const SDL_Surface_Ptr &tile_atlas );
+        void upload_atlas_part( const SDL_Surface_Ptr &tile_atlas, const SDL_Rect &part );
 
         void copy_surface_to_texture( const SDL_Surface_Ptr &surf, const point &offset,
                                       std::vector<texture> &target );
@@ -249,9 +339,11 @@ class tileset_loader
          * @param pump_events Handle window events and refresh the screen when necessary.
          *        Please ensure that the tileset is not accessed when this method is
          *        executing if you set it to true.
+         * @param stream If true and the image size can be read from its header, only indexes
+         *        the sprites and leaves decoding the image to @ref load_next_chunk.
          * @throw std::exception If the image can not be loaded.
          */
-        void load_tileset( const std::string &path, bool pump_events );
+        void load_tileset( const std::string &path, bool pump_events, bool stream = false );
         /**
          * Load tiles from json data.This expects a "tiles" array in
          * <B>config</B>. That array should contain all the tile definition that
@@ -272,9 +364,10 @@ class tileset_loader
          * @throw std::exception On any error.
          */
         void load_internal( const JsonObject &config, const std::string &tileset_root,
-                            const std::string &img_path, bool pump_events );
+                            const std::string &img_path, bool pump_events, bool stream );
     public:
         tileset_loader( tileset &ts, const SDL_Renderer_Ptr &r ) : ts( ts ), renderer( r ) {
+            ts.renderer = &r;
         }
         /**
          * @throw std::exception On any error.
@@ -283,8 +376,21 @@ class tileset_loader
          * @param pump_events Handle window events and refresh the screen when necessary.
          *        Please ensure that the tileset is not accessed when this method is
          *        executing if you set it to true.
+         * @param stream If true, only the tile definitions are loaded right away. The images
+         *        are decoded and uploaded by later calls to @ref load_next_chunk, until then
+         *        their sprites are drawn as a placeholder.
          */
-        void load( const std::string &tileset_id, bool precheck, bool pump_events = false );
+        void load( const std::string &tileset_id, bool precheck, bool pump_events = false,
+                   bool stream = false );
+        /**
+         * Decodes the next streamed tile atlas, or uploads the next part of one.
+         * @return false if there was nothing left to load.
+         * @throw std::exception If the image can not be loaded.
+         */
+        bool load_next_chunk();
+        bool done() const {
+            return pending_atlases.empty();
+        }
 };
 
 enum class text_alignment : int {
@@ -522,10 +628,17 @@ class cata_tiles
          * @param pump_events Handle window events and refresh the screen when necessary.
          *        Please ensure that the tileset is not accessed when this method is
          *        executing if you set it to true.
+         * @param stream If true, the tile images are decoded over the following frames by
+         *        @ref continue_tileset_loading instead of right away.
          * @throw std::exception On any error.
          */
         void load_tileset( const std::string &tileset_id, bool precheck = false,
-                           bool force = false, bool pump_events = false );
+                           bool force = false, bool pump_events = false, bool stream = false );
+        /**
+         * Loads the next chunk of a tileset that is being streamed in.
+         * @return false if there was nothing left to load.
+         */
+        bool continue_tileset_loading();
         /**
          * Reinitializes the current tileset, like @ref init, but using the original screen information.
          * @throw std::exception On any error.
@@ -571,6 +684,8 @@ class cata_tiles
         const SDL_Renderer_Ptr &renderer;
         const GeometryRenderer_Ptr &geometry;
         std::unique_ptr<tileset> tileset_ptr;
+        // loads the rest of tileset_ptr while it is being streamed in
+        std::unique_ptr<tileset_loader> tileset_streamer;
 
         int tile_height = 0;
         int tile_width = 0;
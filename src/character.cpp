@@ -3331,6 +3331,8 @@ item Character::remove_weapon()
     weapon = item();
     get_event_bus().send<event_type::character_wields_item>( getID(), weapon.typeId() );
     cached_info.erase( "weapon_value" );
+    invalidate_enchantment_cache();
+    invalidate_ups_item_index();
     return tmp;
 }
 
@@ -3989,6 +3991,33 @@ ret_val<bool> Character::can_drop( const item &it ) const
 void Character::invalidate_inventory_validity_cache()
 {
     cache_inventory_is_valid = false;
+    // Anything that moves items in or out of the inventory can change these as well
+    invalidate_enchantment_cache();
+    invalidate_ups_item_index();
+}
+
+void Character::invalidate_ups_item_index()
+{
+    ups_items.dirty = true;
+}
+
+void Character::update_ups_item_index()
+{
+    ups_items.providers.clear();
+    ups_items.consumers.clear();
+    const std::vector<item *> providers = items_with( []( const item & itm ) {
+        return itm.has_flag( flag_IS_UPS );
+    } );
+    for( item *it : providers ) {
+        ups_items.providers.push_back( it->get_safe_reference() );
+    }
+    const std::vector<item *> consumers = items_with( []( const item & itm ) {
+        return itm.has_flag( flag_USE_UPS );
+    } );
+    for( item *it : consumers ) {
+        ups_items.consumers.push_back( it->get_safe_reference() );
+    }
+    ups_items.dirty = false;
 }
 
 void Character::drop_invalid_inventory()
@@ -5564,7 +5593,12 @@ void Character::update_body( const time_point &from, const time_point &to )
         update_stamina( to_turns<int>( to - from ) );
     }
     update_stomach( from, to );
-    recalculate_enchantment_cache();
+    // Item states can change without the character noticing (e.g. deep inside a container),
+    // so the cache is refreshed every so often regardless.
+    if( ticks_between( from, to, 5_minutes ) > 0 ) {
+        invalidate_enchantment_cache();
+    }
+    update_enchantment_cache();
     if( ticks_between( from, to, 3_minutes ) > 0 ) {
         magic->update_mana( *this->as_player(), to_turns<float>( 3_minutes ) );
     }
@@ -5592,28 +5626,21 @@ void Character::update_body( const time_point &from, const time_point &to )
         get_sick();
     }
 
-    for( const auto &v : vitamin::all() ) {
-        const time_duration rate = vitamin_rate( v.first );
-
+    if( upkeep_schedules_dirty ) {
+        schedule_upkeep( from );
+    }
+    vitamin_schedule.run_due( from, to, [this]( const vitamin_upkeep & upkeep, int qty ) {
         // No blood volume regeneration if body lacks fluids
-        if( v.first == vitamin_blood && has_effect( effect_hypovolemia ) && get_thirst() > 240 ) {
-            continue;
+        if( upkeep.vit == vitamin_blood && has_effect( effect_hypovolemia ) && get_thirst() > 240 ) {
+            return;
         }
-
-        if( rate > 0_turns ) {
-            int qty = ticks_between( from, to, rate );
-            if( qty > 0 ) {
-                vitamin_mod( v.first, 0 - qty );
-            }
-
-        } else if( rate < 0_turns ) {
+        if( upkeep.rate > 0_turns ) {
+            vitamin_mod( upkeep.vit, 0 - qty );
+        } else {
             // mutations can result in vitamins being generated (but never accumulated)
-            int qty = ticks_between( from, to, -rate );
-            if( qty > 0 ) {
-                vitamin_mod( v.first, qty );
-            }
+            vitamin_mod( upkeep.vit, qty );
         }
-    }
+    } );
 
     if( is_avatar() && ticks_between( from, to, 24_hours ) > 0 ) {
         as_avatar()->advance_daily_calories();
@@ -5736,6 +5763,24 @@ float Character::activity_level() const
     return std::min( max, attempted_level );
 }
 
+void Character::schedule_upkeep( const time_point &now )
+{
+    vitamin_schedule.clear();
+    for( const auto &v : vitamin::all() ) {
+        const time_duration rate = vitamin_rate( v.first );
+        if( rate != 0_turns ) {
+            vitamin_schedule.add( vitamin_upkeep{ v.first, rate }, rate > 0_turns ? rate : -rate, now );
+        }
+    }
+    water_schedule.clear();
+    for( const trait_id &mut_id : get_mutations() ) {
+        if( mut_id->weakness_to_water != 0 ) {
+            water_schedule.add( mut_id, 1_minutes, now );
+        }
+    }
+    upkeep_schedules_dirty = false;
+}
+
 void Character::update_stomach( const time_point &from, const time_point &to )
 {
     const needs_rates rates = calc_needs_rates();
@@ -8768,6 +8813,9 @@ bool Character::invoke_item( item *used, const std::string &method, const tripoi
         moves = pre_obtain_moves;
         return false;
     }
+    // Using an item may have toggled or transformed it
+    invalidate_enchantment_cache();
+    invalidate_ups_item_index();
     if( charges_used.value() == 0 ) {
         return false;
     }
@@ -9409,15 +9457,15 @@ mutation_category_id Character::get_highest_category() const
     return sMaxCat;
 }
 
-void Character::recalculate_enchantment_cache()
+enchantment Character::calc_enchantment_cache() const
 {
     // start by resetting the cache to all inventory items
-    *enchantment_cache = inv->get_active_enchantment_cache( *this );
+    enchantment ret = inv->get_active_enchantment_cache( *this );
 
-    visit_items( [&]( const item * it, item * ) {
+    visit_items( [&]( const item * it, const item * ) {
         for( const enchantment &ench : it->get_enchantments() ) {
             if( ench.is_active( *this, *it ) ) {
-                enchantment_cache->force_add( ench );
+                ret.force_add( ench );
             }
         }
         return VisitResponse::NEXT;
@@ -9430,7 +9478,7 @@ void Character::recalculate_enchantment_cache()
         for( const enchantment_id &ench_id : mut.enchantments ) {
             const enchantment &ench = ench_id.obj();
             if( ench.is_active( *this, mut.activated && mut_map.second.powered ) ) {
-                enchantment_cache->force_add( ench );
+                ret.force_add( ench );
             }
         }
     }
@@ -9442,10 +9490,47 @@ void Character::recalculate_enchantment_cache()
             const enchantment &ench = ench_id.obj();
             if( ench.is_active( *this, bio.powered &&
                                 bid->has_flag( STATIC( json_character_flag( "BIONIC_TOGGLED" ) ) ) ) ) {
-                enchantment_cache->force_add( ench );
+                ret.force_add( ench );
             }
         }
     }
+    return ret;
+}
+
+static std::pair<bool, bool> enchantment_surroundings( const Character &guy )
+{
+    return std::make_pair( guy.pos().z < 0, get_map().is_divable( guy.pos() ) );
+}
+
+void Character::recalculate_enchantment_cache()
+{
+    *enchantment_cache = calc_enchantment_cache();
+    enchantment_cache_dirty = false;
+    enchantment_cache_surroundings = enchantment_surroundings( *this );
+    // enchantments can grant mutations, which modify vitamin rates and water weakness
+    upkeep_schedules_dirty = true;
+}
+
+void Character::invalidate_enchantment_cache()
+{
+    enchantment_cache_dirty = true;
+}
+
+void Character::update_enchantment_cache()
+{
+    // Conditional enchantments depend on where the character is, on top of what they carry.
+    if( enchantment_cache_dirty ||
+        enchantment_cache_surroundings != enchantment_surroundings( *this ) ) {
+        recalculate_enchantment_cache();
+    } else if( debug_mode ) {
+        // Something changed without invalidating the cache
+        const enchantment fresh = calc_enchantment_cache();
+        if( !fresh.same_total( *enchantment_cache ) ) {
+            debugmsg( "Enchantment cache of %s is stale", disp_name() );
+            *enchantment_cache = fresh;
+            upkeep_schedules_dirty = true;
+        }
+    }
 }
 
 double Character::calculate_by_enchantment( double modify, enchant_vals::mod value,
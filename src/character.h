@@ -47,10 +47,12 @@
 #include "point.h"
 #include "recipe.h"
 #include "ret_val.h"
+#include "safe_reference.h"
 #include "stomach.h"
 #include "string_formatter.h"
 #include "type_id.h"
 #include "units_fwd.h"
+#include "upkeep_schedule.h"
 #include "visitable.h"
 #include "weighted_list.h"
 
@@ -1133,6 +1135,8 @@ class Character : public Creature, public visitable
 
         // recalculates enchantment cache by iterating through all held, worn, and wielded items
         void recalculate_enchantment_cache();
+        // marks the enchantment cache stale, so the next update_body rebuilds it
+        void invalidate_enchantment_cache();
         // gets add and mult value from enchantment cache
         double calculate_by_enchantment( double modify, enchant_vals::mod value,
                                          bool round_output = false ) const;
@@ -1754,6 +1758,8 @@ class Character : public Creature, public visitable
         void drop_invalid_inventory();
         // this cache is for checking if items in the character's inventory can't actually fit into other items they are inside of
         void invalidate_inventory_validity_cache();
+        // marks the index of UPS and UPS powered items stale, so the next use rebuilds it
+        void invalidate_ups_item_index();
 
         void invalidate_weight_carried_cache();
         /** Returns all items that must be taken off before taking off this item */
@@ -2802,6 +2808,28 @@ class Character : public Creature, public visitable
          * If it is nullopt, needs to be recalculated
          */
         mutable cata::optional<units::mass> cached_weight_carried = cata::nullopt;
+        /**
+         * The carried UPS and the carried items drawing on them, in the order
+         * @ref items_with finds them. Kept for @ref player::process_items so the
+         * per-turn charging does not need to look through the whole inventory.
+         */
+        struct ups_item_index {
+            std::vector<safe_reference<item>> providers;
+            std::vector<safe_reference<item>> consumers;
+            bool dirty = true;
+
+            ups_item_index() = default;
+            // A copy would point at the items of the character it was copied from.
+            ups_item_index( const ups_item_index & ) {}
+            ups_item_index &operator=( const ups_item_index & ) {
+                providers.clear();
+                consumers.clear();
+                dirty = true;
+                return *this;
+            }
+        };
+        ups_item_index ups_items;
+        void update_ups_item_index();
 
         void store( JsonOut &json ) const;
         void load( const JsonObject &data );
@@ -2891,8 +2919,29 @@ class Character : public Creature, public visitable
         void burn_fuel( int b, const auto_toggle_bionic_result &result );
 
         // a cache of all active enchantment values.
-        // is recalculated every turn in Character::recalculate_enchantment_cache
+        // is recalculated in Character::recalculate_enchantment_cache when something it depends
+        // on changed, see Character::invalidate_enchantment_cache
         pimpl<enchantment> enchantment_cache;
+        bool enchantment_cache_dirty = true;
+        // whether the character was underground and underwater when the cache was built
+        std::pair<bool, bool> enchantment_cache_surroundings;
+        // all enchantments currently active, built from scratch
+        enchantment calc_enchantment_cache() const;
+        // rebuilds the enchantment cache if it is stale, called every turn from update_body
+        void update_enchantment_cache();
+
+        struct vitamin_upkeep {
+            vitamin_id vit;
+            // vitamin_rate when the vitamin was scheduled, negative rates generate the vitamin
+            time_duration rate;
+        };
+        // vitamins with a nonzero rate, due whenever their rate ticks over
+        upkeep_schedule<vitamin_upkeep> vitamin_schedule;
+        // mutations that water hurts or heals, due once a minute, see suffer()
+        upkeep_schedule<trait_id> water_schedule;
+        // set when mutations change, as they modify vitamin rates and water weakness
+        bool upkeep_schedules_dirty = true;
+        void schedule_upkeep( const time_point &now );
         player_activity destination_activity;
         /// A unique ID number, assigned by the game class. Values should never be reused.
         character_id id;
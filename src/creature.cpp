@@ -346,6 +346,8 @@ bool Creature::sees( const tripoint &t, bool is_avatar, int range_mod ) const
             int adj_range = std::floor( range * player_visibility_factor );
             return adj_range >= wanted_range &&
                    here.get_cache_ref( pos().z ).seen_cache[pos().x][pos().y] > LIGHT_TRANSPARENCY_SOLID;
+        } else if( viewer_fov_cache ) {
+            return here.sees_from_fov( pos(), t, range );
         } else {
             return here.sees( pos(), t, range );
         }
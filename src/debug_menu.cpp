@@ -62,6 +62,7 @@
 #include "magic.h"
 #include "map.h"
 #include "map_extras.h"
+#include "mapbuffer.h"
 #include "mapgen.h"
 #include "mapgendata.h"
 #include "martialarts.h"
@@ -192,6 +193,7 @@ std::string enum_to_string<debug_menu::debug_menu_index>( debug_menu::debug_menu
         case debug_menu::debug_menu_index::NESTED_MAPGEN: return "NESTED_MAPGEN";
         case debug_menu::debug_menu_index::VEHICLE_BATTERY_CHARGE: return "VEHICLE_BATTERY_CHARGE";
         case debug_menu::debug_menu_index::GENERATE_EFFECT_LIST: return "GENERATE_EFFECT_LIST";
+        case debug_menu::debug_menu_index::DISPLAY_MAPBUFFER: return "DISPLAY_MAPBUFFER";
         // *INDENT-ON*
         case debug_menu::debug_menu_index::last:
             break;
@@ -275,6 +277,7 @@ static int info_uilist( bool display_all_entries = true )
             { uilist_entry( debug_menu_index::TEST_WEATHER, true, 'W', _( "Test weather" ) ) },
             { uilist_entry( debug_menu_index::TEST_MAP_EXTRA_DISTRIBUTION, true, 'e', _( "Test map extra list" ) ) },
             { uilist_entry( debug_menu_index::GENERATE_EFFECT_LIST, true, 'L', _( "Generate effect list" ) ) },
+            { uilist_entry( debug_menu_index::DISPLAY_MAPBUFFER, true, 'B', _( "Display map buffer residency" ) ) },
         };
         uilist_initializer.insert( uilist_initializer.begin(), debug_only_options.begin(),
                                    debug_only_options.end() );
@@ -1324,6 +1327,7 @@ void debug()
         debug_menu_index::ENABLE_ACHIEVEMENTS,
         debug_menu_index::BENCHMARK,
         debug_menu_index::SHOW_MSG,
+        debug_menu_index::DISPLAY_MAPBUFFER,
     };
     bool should_disable_achievements = action && !non_cheaty_options.count( *action );
     if( should_disable_achievements && achievements.is_enabled() ) {
@@ -1834,6 +1838,14 @@ void debug()
         case debug_menu_index::HOUR_TIMER:
             g->toggle_debug_hour_timer();
             break;
+        case debug_menu_index::DISPLAY_MAPBUFFER: {
+            const int budget = get_option<int>( "MAPBUFFER_BUDGET" );
+            popup( _( "Resident submaps: %d\nApproximate memory: %.1f MiB\nBudget: %s\nEvicted submaps: %d" ),
+                   MAPBUFFER.resident_submaps(), MAPBUFFER.resident_bytes() / ( 1024.0 * 1024.0 ),
+                   budget > 0 ? string_format( _( "%d MiB" ), budget ) : _( "unlimited" ),
+                   MAPBUFFER.evicted_submaps() );
+            break;
+        }
         case debug_menu_index::CHANGE_TIME: {
             auto set_turn = [&]( const int initial, const time_duration & factor, const char *const msg ) {
                 const auto text = string_input_popup()
@@ -736,7 +736,7 @@ void editmap::update_view_with_help( const std::string &txt, const std::string &
                  );
         off++; // 3
     }
-    const auto &map_cache = here.get_cache( target.z );
+    const auto &map_cache = here.get_cache_ref( target.z );
 
     Character &player_character = get_player_character();
     const std::string u_see_msg = player_character.sees( target ) ? _( "yes" ) : _( "no" );
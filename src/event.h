@@ -739,12 +739,30 @@ class event
     public:
         using data_type = std::map<std::string, cata_variant>;
 
+        // No event_spec has more fields than this, so the values of events
+        // made through make() fit inline without any allocation.
+        static constexpr size_t max_fields = 6;
+        using field_values = std::array<cata_variant, max_fields>;
+        using spec_field = std::pair<const char *, cata_variant_type>;
+
         event( event_type type, time_point time, data_type &&data )
             : type_( type )
             , time_( time )
             , data_( std::move( data ) )
         {}
 
+        // Used by make(); spec_fields points at the fields of the event_spec
+        // and the first num_fields entries of values are their values.
+        event( event_type type, time_point time, const spec_field *spec_fields, size_t num_fields,
+               field_values &&values )
+            : type_( type )
+            , time_( time )
+            , spec_fields_( spec_fields )
+            , num_fields_( num_fields )
+            , from_spec_( true )
+            , values_( std::move( values ) )
+        {}
+
         // Call this to construct an event in a type-safe manner.  It will
         // verify that the types you pass match the expected types for the
         // event_type you pass as a template parameter.
@@ -757,6 +775,8 @@ class event
                            "spec for this event type must be defined and empty" );
             static_assert( sizeof...( Args ) == Spec::fields.size(),
                            "wrong number of arguments for event type" );
+            static_assert( Spec::fields.size() <= max_fields,
+                           "event type has more fields than event::max_fields" );
 
             return event_detail::make_event_helper <
                    Type, std::make_index_sequence<sizeof...( Args )>
@@ -774,21 +794,21 @@ class event
         }
 
         cata_variant get_variant( const std::string &key ) const {
-            auto it = data_.find( key );
-            if( it == data_.end() ) {
+            const cata_variant *value = find( key );
+            if( !value ) {
                 debugmsg( "No such key %s in event of type %s", key,
                           io::enum_to_string( type_ ) );
                 abort();
             }
-            return it->second;
+            return *value;
         }
 
         cata_variant get_variant_or_void( const std::string &key ) const {
-            auto it = data_.find( key );
-            if( it == data_.end() ) {
+            const cata_variant *value = find( key );
+            if( !value ) {
                 return cata_variant();
             }
-            return it->second;
+            return *value;
         }
 
         template<cata_variant_type Type>
@@ -801,12 +821,53 @@ class event
             return get_variant( key ).get<T>();
         }
 
-        const data_type &data() const {
-            return data_;
+        // Whether the event was made through make(), in which case all its
+        // fields are in values() and the keys are fixed by its type.
+        bool from_spec() const {
+            return from_spec_;
+        }
+
+        // The field values in the order of the event_spec, padded with void
+        // variants.  Only meaningful when from_spec().
+        const field_values &values() const {
+            return values_;
+        }
+
+        // The fields as a map, which is the form they are serialized and
+        // matched against achievement criteria in.  This allocates, so it
+        // should not be called for every event.
+        data_type data() const {
+            if( !from_spec_ ) {
+                return data_;
+            }
+            data_type result;
+            for( size_t i = 0; i < num_fields_; ++i ) {
+                result.emplace( spec_fields_[i].first, values_[i] );
+            }
+            return result;
+        }
+
+        // The value of the field, or nullptr if the event has no such field.
+        // Unlike data(), this doesn't allocate.
+        const cata_variant *find( const std::string &key ) const {
+            if( from_spec_ ) {
+                for( size_t i = 0; i < num_fields_; ++i ) {
+                    if( key == spec_fields_[i].first ) {
+                        return &values_[i];
+                    }
+                }
+                return nullptr;
+            }
+            auto it = data_.find( key );
+            return it == data_.end() ? nullptr : &it->second;
         }
     private:
         event_type type_;
         time_point time_;
+        const spec_field *spec_fields_ = nullptr;
+        size_t num_fields_ = 0;
+        bool from_spec_ = false;
+        field_values values_;
         data_type data_;
 };
 
@@ -819,13 +880,9 @@ struct make_event_helper<Type, std::index_sequence<I...>> {
 
     template<typename... Args>
     event operator()( time_point time, Args &&... args ) {
-        return event(
-                   Type,
-                   time,
-        std::map<std::string, cata_variant> { {
-                Spec::fields[I].first,
-                cata_variant::make<Spec::fields[I].second>( args )
-            } ...
+        return event( Type, time, Spec::fields.data(), Spec::fields.size(), event::field_values{ {
+                cata_variant::make<Spec::fields[I].second>( args )...
+            }
         } );
     }
 };
@@ -466,6 +466,27 @@ struct event_transformation_impl : public event_transformation::impl {
         return result;
     }
 
+    // Whether the constraints on the fields the event comes with already rule it out.  This
+    // reads the event's values in place, so events that don't match never build their data map.
+    bool rules_out( const cata::event &e, stats_tracker &stats ) const {
+        for( const std::pair<std::string, value_constraint> &p : constraints_ ) {
+            const std::string &field = p.first;
+            const bool added = std::any_of( new_fields_.begin(), new_fields_.end(),
+            [&]( const std::pair<std::string, new_field> &f ) {
+                return f.first == field;
+            } );
+            if( added ) {
+                // Only known after the transformation
+                continue;
+            }
+            const cata_variant *value = e.find( field );
+            if( !value || !p.second.permits( *value, stats ) ) {
+                return true;
+            }
+        }
+        return false;
+    }
+
     event_multiset initialize( const event_multiset::summaries_type &input,
                                stats_tracker &stats ) const {
         event_multiset result;
@@ -534,6 +555,9 @@ struct event_transformation_impl : public event_transformation::impl {
         }
 
         void event_added( const cata::event &e, stats_tracker &stats ) override {
+            if( transformation_->rules_out( e, stats ) ) {
+                return;
+            }
             EventVector transformed = transformation_->match_and_transform( e.data(), stats );
             for( cata::event::data_type &d : transformed ) {
                 cata::event new_event( e.type(), e.time(), std::move( d ) );
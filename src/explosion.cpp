@@ -9,9 +9,7 @@
 #include <limits>
 #include <map>
 #include <memory>
-#include <queue>
 #include <random>
-#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -33,6 +31,7 @@
 #include "item_factory.h"
 #include "itype.h"
 #include "json.h"
+#include "lightmap.h"
 #include "line.h"
 #include "make_static.h"
 #include "map.h"
@@ -89,6 +88,8 @@ static float fragment_area = 0.00001f;
 static constexpr float MIN_EFFECTIVE_VELOCITY = 70.0f;
 // Pretty arbitrary minimum density.  1/1,000 change of a fragment passing through the given square.
 static constexpr float MIN_FRAGMENT_DENSITY = 0.0001f;
+// SWAG coefficient of drag.
+static constexpr float FRAGMENT_DRAG_COEFFICIENT = 0.5f;
 
 explosion_data load_explosion_data( const JsonObject &jo )
 {
@@ -122,6 +123,67 @@ shrapnel_data load_shrapnel_data( const JsonObject &jo )
     ret.drop = itype_id( jo.get_string( "drop", "null" ) );
     return ret;
 }
+
+namespace
+{
+
+/** State of a single tile of the area reached by a blast. */
+struct blast_cell {
+    /** Shortest known blast distance to the tile. */
+    float dist = std::numeric_limits<float>::max();
+    bool closed = false;
+    bool bashed = false;
+    /** Cached result of map::passable, valid in the front bucket it was checked in. */
+    bool passable = false;
+    int passable_checked = -1;
+};
+
+/** A bash of the blast front, applied once the whole front bucket is processed. */
+struct blast_bash {
+    tripoint pos;
+    float force;
+    bool bash_floor;
+};
+
+/**
+ * Flat array of @ref blast_cell covering the bounding box of a blast.
+ * Cells are stored in the order of tripoint::operator<, so walking the array
+ * visits tiles in the same order as a std::set<tripoint> would.
+ */
+class blast_grid
+{
+    public:
+        blast_grid( const tripoint &min, const tripoint &max ) : min( min ),
+            size( max - min + tripoint( 1, 1, 1 ) ),
+            cells( static_cast<size_t>( size.x ) * size.y * size.z ) {
+        }
+
+        bool contains( const tripoint &p ) const {
+            const tripoint rel = p - min;
+            return rel.x >= 0 && rel.y >= 0 && rel.z >= 0 &&
+                   rel.x < size.x && rel.y < size.y && rel.z < size.z;
+        }
+        blast_cell &at( const tripoint &p ) {
+            const tripoint rel = p - min;
+            return cells[( static_cast<size_t>( rel.x ) * size.y + rel.y ) * size.z + rel.z];
+        }
+        tripoint position( size_t index ) const {
+            const int z = index % size.z;
+            index /= size.z;
+            return min + tripoint( index / size.y, index % size.y, z );
+        }
+        const std::vector<blast_cell> &all() const {
+            return cells;
+        }
+
+    private:
+        tripoint min;
+        tripoint size;
+        std::vector<blast_cell> cells;
+};
+
+} // namespace
+
 namespace explosion_handler
 {
 
@@ -169,99 +231,163 @@ static void do_blast( const tripoint &p, const float power,
 
     here.bash( p, fire ? power : ( 2 * power ), true, false, false );
 
-    std::priority_queue< std::pair<float, tripoint>, std::vector< std::pair<float, tripoint> >, pair_greater_cmp_first >
-    open;
-    std::set<tripoint> closed;
-    std::set<tripoint> bashed{ p };
-    std::map<tripoint, float> dist_map;
-    open.push( std::make_pair( 0.0f, p ) );
-    dist_map[p] = 0.0f;
-    // Find all points to blast
-    while( !open.empty() ) {
-        // Add some random factor to effective distance to make it look cooler
-        const float distance = open.top().first * rng_float( 1.0f, 1.2f );
-        const tripoint pt = open.top().second;
-        open.pop();
-
-        if( closed.count( pt ) != 0 ) {
-            continue;
+    // The blast stops propagating once its force drops to 1, which bounds the area it can
+    // reach. Every step costs at least tile_dist, one more tile is bashed past the edge.
+    const float max_dist = power > 1.0f ? std::log( power ) / -std::log( distance_factor ) : 0.0f;
+    const int reach = static_cast<int>( std::min( std::ceil( max_dist / tile_dist ),
+                                        static_cast<float>( MAPSIZE_X ) ) ) + 1;
+    const int z_reach = !here.has_zlevels() ? 0 :
+                        static_cast<int>( std::min( std::ceil( max_dist / ( tile_dist + zlev_dist ) ),
+                                          static_cast<float>( OVERMAP_LAYERS ) ) ) + 1;
+    const tripoint blast_min( std::max( p.x - reach, 0 ), std::max( p.y - reach, 0 ),
+                              std::max( p.z - z_reach, -OVERMAP_DEPTH ) );
+    const tripoint blast_max( std::min( p.x + reach, MAPSIZE_X - 1 ),
+                              std::min( p.y + reach, MAPSIZE_Y - 1 ),
+                              std::min( p.z + z_reach, OVERMAP_HEIGHT ) );
+    blast_grid grid( blast_min, blast_max );
+
+    // Bucket queue of the blast front, bucket n holds distances in [n, n + 1) * tile_dist.
+    // Every step adds at least tile_dist, so processing a bucket only ever adds to later
+    // buckets and the tiles in a bucket can be processed in any (fixed) order.
+    std::vector<std::vector<std::pair<float, tripoint>>> front;
+    const auto push = [&front, tile_dist]( const float dist, const tripoint & pt ) {
+        const size_t bucket = static_cast<size_t>( dist / tile_dist );
+        if( bucket >= front.size() ) {
+            front.resize( bucket + 1 );
         }
-
-        closed.insert( pt );
-
-        const float force = power * std::pow( distance_factor, distance );
-        if( force <= 1.0f ) {
-            continue;
+        front[bucket].emplace_back( dist, pt );
+    };
+    // Bashes are only applied between buckets, so the map doesn't change under the front.
+    std::vector<blast_bash> bashes;
+    int current_bucket = 0;
+    const auto passable = [&]( const tripoint & pt ) {
+        if( !grid.contains( pt ) ) {
+            return here.passable( pt );
         }
-
-        if( here.impassable( pt ) && pt != p ) {
-            // Don't propagate further
-            continue;
+        blast_cell &cell = grid.at( pt );
+        if( cell.passable_checked != current_bucket ) {
+            cell.passable = here.passable( pt );
+            cell.passable_checked = current_bucket;
         }
+        return cell.passable;
+    };
+    const auto is_closed = [&grid]( const tripoint & pt ) {
+        return grid.contains( pt ) && grid.at( pt ).closed;
+    };
+
+    push( 0.0f, p );
+    grid.at( p ).dist = 0.0f;
+    grid.at( p ).bashed = true;
+    // Find all points to blast
+    for( size_t bucket = 0; bucket < front.size(); bucket++ ) {
+        current_bucket = static_cast<int>( bucket );
+        for( size_t entry = 0; entry < front[bucket].size(); entry++ ) {
+            const float key = front[bucket][entry].first;
+            const tripoint pt = front[bucket][entry].second;
+            blast_cell &cell = grid.at( pt );
+            if( cell.closed || key > cell.dist ) {
+                continue;
+            }
+
+            cell.closed = true;
 
-        // Those will be used for making "shaped charges"
-        // Don't check up/down (for now) - this will make 2D/3D balancing easier
-        int empty_neighbors = 0;
-        for( size_t i = 0; i < 8; i++ ) {
-            tripoint dest( pt + tripoint( x_offset[i], y_offset[i], z_offset[i] ) );
-            if( closed.count( dest ) == 0 && here.valid_move( pt, dest, false, true ) ) {
-                empty_neighbors++;
+            // Add some random factor to effective distance to make it look cooler
+            const float distance = key * rng_float( 1.0f, 1.2f );
+            const float force = power * std::pow( distance_factor, distance );
+            if( force <= 1.0f ) {
+                continue;
             }
-        }
 
-        empty_neighbors = std::max( 1, empty_neighbors );
-        // Iterate over all neighbors. Bash all of them, propagate to some
-        for( size_t i = 0; i < max_index; i++ ) {
-            tripoint dest( pt + tripoint( x_offset[i], y_offset[i], z_offset[i] ) );
-            if( closed.count( dest ) != 0 || !here.inbounds( dest ) ) {
+            if( !passable( pt ) && pt != p ) {
+                // Don't propagate further
                 continue;
             }
 
-            if( bashed.count( dest ) == 0 ) {
-                bashed.insert( dest );
-                // Up to 200% bonus for shaped charge
-                // But not if the explosion is fiery, then only half the force and no bonus
-                const float bash_force = !fire ?
-                                         force + ( 2 * force / empty_neighbors ) :
-                                         force / 2;
-                if( z_offset[i] == 0 ) {
-                    // Horizontal - no floor bashing
-                    here.bash( dest, bash_force, true, false, false );
-                } else if( z_offset[i] > 0 ) {
-                    // Should actually bash through the floor first, but that's not really possible yet
-                    here.bash( dest, bash_force, true, false, true );
-                } else if( !here.valid_move( pt, dest, false, true ) ) {
-                    // Only bash through floor if it doesn't exist
-                    // Bash the current tile's floor, not the one's below
-                    here.bash( pt, bash_force, true, false, true );
+            // Those will be used for making "shaped charges"
+            // Don't check up/down (for now) - this will make 2D/3D balancing easier
+            int empty_neighbors = 0;
+            for( size_t i = 0; i < 8; i++ ) {
+                const tripoint dest( pt + tripoint( x_offset[i], y_offset[i], z_offset[i] ) );
+                if( !is_closed( dest ) && passable( dest ) ) {
+                    empty_neighbors++;
                 }
             }
 
-            float next_dist = distance;
-            next_dist += ( x_offset[i] == 0 || y_offset[i] == 0 ) ? tile_dist : diag_dist;
-            if( z_offset[i] != 0 ) {
-                if( !here.valid_move( pt, dest, false, true ) ) {
+            empty_neighbors = std::max( 1, empty_neighbors );
+            // Iterate over all neighbors. Bash all of them, propagate to some
+            for( size_t i = 0; i < max_index; i++ ) {
+                const tripoint dest( pt + tripoint( x_offset[i], y_offset[i], z_offset[i] ) );
+                if( !grid.contains( dest ) ) {
+                    continue;
+                }
+                blast_cell &dest_cell = grid.at( dest );
+                if( dest_cell.closed ) {
                     continue;
                 }
 
-                next_dist += zlev_dist;
-            }
+                if( !dest_cell.bashed ) {
+                    dest_cell.bashed = true;
+                    // Up to 200% bonus for shaped charge
+                    // But not if the explosion is fiery, then only half the force and no bonus
+                    const float bash_force = !fire ?
+                                             force + ( 2 * force / empty_neighbors ) :
+                                             force / 2;
+                    if( z_offset[i] == 0 ) {
+                        // Horizontal - no floor bashing
+                        bashes.push_back( { dest, bash_force, false } );
+                    } else if( z_offset[i] > 0 ) {
+                        // Should actually bash through the floor first, but that's not really possible yet
+                        bashes.push_back( { dest, bash_force, true } );
+                    } else if( !here.valid_move( pt, dest, false, true ) ) {
+                        // Only bash through floor if it doesn't exist
+                        // Bash the current tile's floor, not the one's below
+                        bashes.push_back( { pt, bash_force, true } );
+                    }
+                }
 
-            if( dist_map.count( dest ) == 0 || dist_map[dest] > next_dist ) {
-                open.push( std::make_pair( next_dist, dest ) );
-                dist_map[dest] = next_dist;
+                float next_dist = distance;
+                next_dist += ( x_offset[i] == 0 || y_offset[i] == 0 ) ? tile_dist : diag_dist;
+                if( z_offset[i] != 0 ) {
+                    if( !here.valid_move( pt, dest, false, true ) ) {
+                        continue;
+                    }
+
+                    next_dist += zlev_dist;
+                }
+
+                if( dest_cell.dist > next_dist ) {
+                    push( next_dist, dest );
+                    dest_cell.dist = next_dist;
+                }
             }
         }
+        front[bucket].clear();
+        front[bucket].shrink_to_fit();
+
+        for( const blast_bash &bash : bashes ) {
+            here.bash( bash.pos, bash.force, true, false, bash.bash_floor );
+        }
+        bashes.clear();
+    }
+
+    // All the tiles the blast reached, with their distance, ordered by position
+    std::vector<std::pair<tripoint, float>> blasted;
+    const std::vector<blast_cell> &cells = grid.all();
+    for( size_t i = 0; i < cells.size(); i++ ) {
+        if( cells[i].closed ) {
+            blasted.emplace_back( grid.position( i ), cells[i].dist );
+        }
     }
 
     // Draw the explosion
     std::map<tripoint, nc_color> explosion_colors;
-    for( const tripoint &pt : closed ) {
+    for( const std::pair<tripoint, float> &tile : blasted ) {
+        const tripoint &pt = tile.first;
         if( here.impassable( pt ) ) {
             continue;
         }
 
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+        const float force = power * std::pow( distance_factor, tile.second );
         nc_color col = c_red;
         if( force < 10 ) {
             col = c_white;
@@ -274,8 +400,9 @@ static void do_blast( const tripoint &p, const float power,
 
     draw_custom_explosion( get_player_character().pos(), explosion_colors );
 
-    for( const tripoint &pt : closed ) {
-        const float force = power * std::pow( distance_factor, dist_map.at( pt ) );
+    for( const std::pair<tripoint, float> &tile : blasted ) {
+        const tripoint &pt = tile.first;
+        const float force = power * std::pow( distance_factor, tile.second );
         if( force < 1.0f ) {
             // Too weak to matter
             continue;
@@ -362,6 +489,21 @@ static void do_blast( const tripoint &p, const float power,
     }
 }
 
+/** Caches used by @ref shrapnel, kept around so every explosion doesn't need to allocate them. */
+struct shrapnel_scratch {
+    fragment_cloud obstacle_cache[MAPSIZE_X][MAPSIZE_Y];
+    fragment_cloud visited_cache[MAPSIZE_X][MAPSIZE_Y];
+};
+
+static shrapnel_scratch &get_shrapnel_scratch()
+{
+    static std::unique_ptr<shrapnel_scratch> scratch;
+    if( !scratch ) {
+        scratch = std::make_unique<shrapnel_scratch>();
+    }
+    return *scratch;
+}
+
 static std::vector<tripoint> shrapnel( const tripoint &src, int power,
                                        int casing_mass, float per_fragment_mass, int range = -1 )
 {
@@ -379,16 +521,19 @@ static std::vector<tripoint> shrapnel( const tripoint &src, int power,
     proj.range = range;
     proj.proj_effects.insert( "NULL_SOURCE" );
 
-    fragment_cloud obstacle_cache[MAPSIZE_X][MAPSIZE_Y];
-    fragment_cloud visited_cache[MAPSIZE_X][MAPSIZE_Y];
+    shrapnel_scratch &scratch = get_shrapnel_scratch();
+    fragment_cloud ( &obstacle_cache )[MAPSIZE_X][MAPSIZE_Y] = scratch.obstacle_cache;
+    fragment_cloud ( &visited_cache )[MAPSIZE_X][MAPSIZE_Y] = scratch.visited_cache;
 
     map &here = get_map();
-    // TODO: Calculate range based on max effective range for projectiles.
-    // Basically bisect between 0 and map diameter using shrapnel_calc().
-    // Need to update shadowcasting to support limiting range without adjusting initial distance.
+    // The fragments of real explosives stay effective past the reach of the shadowcast,
+    // so there is nothing to gain from limiting the area to their effective range.
     const tripoint_range<tripoint> area = here.points_on_zlevel( src.z );
 
     here.build_obstacle_cache( area.min(), area.max() + tripoint_south_east, obstacle_cache );
+    for( int x = 0; x < MAPSIZE_X; x++ ) {
+        std::fill_n( &visited_cache[x][0], MAPSIZE_Y, fragment_cloud() );
+    }
 
     // Shadowcasting normally ignores the origin square,
     // so apply it manually to catch monsters standing on the explosive.
@@ -905,11 +1050,9 @@ fragment_cloud shrapnel_calc( const fragment_cloud &initial,
                               const fragment_cloud &cloud,
                               const int &distance )
 {
-    // SWAG coefficient of drag.
-    constexpr float Cd = 0.5f;
     fragment_cloud new_cloud;
     new_cloud.velocity = initial.velocity * std::exp( -cloud.velocity * ( (
-                             Cd * fragment_area * distance ) /
+                             FRAGMENT_DRAG_COEFFICIENT * fragment_area * distance ) /
                          ( 2.0f * fragment_mass ) ) );
     // Two effects, the accumulated proportion of blocked fragments,
     // and the inverse-square dilution of fragments with distance.
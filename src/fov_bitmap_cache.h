@@ -0,0 +1,82 @@
+#pragma once
+#ifndef CATA_SRC_FOV_BITMAP_CACHE_H
+#define CATA_SRC_FOV_BITMAP_CACHE_H
+
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+
+#include "game_constants.h"
+#include "point.h"
+
+/**
+ * Per-viewer field of view bitmaps for creatures other than the player.
+ *
+ * Each entry holds the tiles of the viewer's z-level that a shadowcast from the
+ * viewer's tile reaches within `radius`. Viewers standing on the same tile share
+ * one entry, so pairwise visibility checks become a bit test once the first of
+ * them has paid for the shadowcast. Entries are dropped together with the
+ * line-of-sight cache whenever the seen cache is invalidated.
+ */
+class fov_bitmap_cache
+{
+    public:
+        using bitmap = std::bitset<MAPSIZE_X *MAPSIZE_Y>;
+
+        struct entry {
+            int radius = -1;
+            bitmap visible;
+        };
+
+        /** Scratch grid the shadowcast writes into before it is packed into a bitmap. */
+        struct scratch_grid {
+            float seen[MAPSIZE_X][MAPSIZE_Y];
+        };
+
+        static size_t index( const point &p ) {
+            return static_cast<size_t>( p.x ) * MAPSIZE_Y + p.y;
+        }
+
+        /** Returns the entry for `viewer` if it covers at least `radius`, nullptr otherwise. */
+        const entry *find( const tripoint &viewer, int radius ) const {
+            const auto iter = entries.find( viewer );
+            if( iter == entries.end() || iter->second.radius < radius ) {
+                ++misses_;
+                return nullptr;
+            }
+            ++hits_;
+            return &iter->second;
+        }
+
+        /** Returns the (possibly stale) entry for `viewer`, to be recomputed by the caller. */
+        entry &slot( const tripoint &viewer ) {
+            return entries[viewer];
+        }
+
+        scratch_grid &scratch() {
+            if( !scratch_ ) {
+                scratch_ = std::make_unique<scratch_grid>();
+            }
+            return *scratch_;
+        }
+
+        void clear() {
+            entries.clear();
+        }
+
+        uint64_t hits() const {
+            return hits_;
+        }
+        uint64_t misses() const {
+            return misses_;
+        }
+
+    private:
+        std::unordered_map<tripoint, entry> entries;
+        std::unique_ptr<scratch_grid> scratch_;
+        mutable uint64_t hits_ = 0;
+        mutable uint64_t misses_ = 0;
+};
+
+#endif // CATA_SRC_FOV_BITMAP_CACHE_H
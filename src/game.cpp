@@ -197,6 +197,11 @@ static constexpr int DANGEROUS_PROXIMITY = 5;
 
 static const activity_id ACT_OPERATION( "ACT_OPERATION" );
 static const activity_id ACT_AUTODRIVE( "ACT_AUTODRIVE" );
+static const activity_id ACT_CRAFT( "ACT_CRAFT" );
+static const activity_id ACT_READ( "ACT_READ" );
+static const activity_id ACT_WAIT( "ACT_WAIT" );
+static const activity_id ACT_WAIT_STAMINA( "ACT_WAIT_STAMINA" );
+static const activity_id ACT_WAIT_WEATHER( "ACT_WAIT_WEATHER" );
 
 static const mtype_id mon_manhack( "mon_manhack" );
 
@@ -1421,6 +1426,44 @@ void game::calc_driving_offset( vehicle *veh )
     set_driving_view_offset( point( offset.x, offset.y ) );
 }
 
+// How often the world around the player is processed while fast-forwarding.
+static constexpr time_duration fast_forward_step = 1_minutes;
+
+bool game::can_fast_forward()
+{
+    if( !get_option<bool>( "FAST_FORWARD" ) || uquit == QUIT_WATCH || u.is_dead_state() ) {
+        return false;
+    }
+    if( !u.has_effect( effect_sleep ) ) {
+        // Activities that keep the player in place for a long time
+        static const std::set<activity_id> stationary_activities = {
+            ACT_CRAFT, ACT_READ, ACT_WAIT, ACT_WAIT_STAMINA, ACT_WAIT_WEATHER
+        };
+        if( !u.activity || !stationary_activities.count( u.activity.id() ) ) {
+            return false;
+        }
+    }
+    if( const optional_vpart_position vp = m.veh_at( u.pos() ) ) {
+        if( vp->vehicle().velocity != 0 ) {
+            return false;
+        }
+    }
+    // Anything hostile nearby, seen or not, needs the full per-turn simulation.
+    for( monster &critter : all_monsters() ) {
+        if( rl_dist( u.pos(), critter.pos() ) <= MAX_VIEW_DISTANCE &&
+            u.attitude_to( critter ) == Creature::Attitude::HOSTILE ) {
+            return false;
+        }
+    }
+    for( npc &guy : all_npcs() ) {
+        if( rl_dist( u.pos(), guy.pos() ) <= MAX_VIEW_DISTANCE &&
+            u.attitude_to( guy ) == Creature::Attitude::HOSTILE ) {
+            return false;
+        }
+    }
+    return true;
+}
+
 // MAIN GAME LOOP
 // Returns true if game is over (death, saved, quit, etc)
 bool game::do_turn()
@@ -1470,7 +1513,28 @@ bool game::do_turn()
 
     debug_hour_timer.print_time();
 
-    u.update_body();
+    // While fast-forwarding, the player's body is updated once per step and the screen is
+    // redrawn less often; the world around the player keeps running every turn. The check is
+    // repeated every turn, so anything that interrupts (waking up, the activity ending, a
+    // hostile coming into view) drops back to the regular simulation right away.
+    const bool fast_forwarding = can_fast_forward();
+
+    if( fast_forwarding ) {
+        if( !fast_forward_body_turn ) {
+            fast_forward_body_turn = calendar::turn - 1_turns;
+        }
+        if( calendar::once_every( fast_forward_step ) ) {
+            u.update_body( *fast_forward_body_turn, calendar::turn );
+            fast_forward_body_turn = calendar::turn;
+        }
+    } else {
+        if( fast_forward_body_turn && *fast_forward_body_turn < calendar::turn - 1_turns ) {
+            // Catch up on what is left of the interrupted step
+            u.update_body( *fast_forward_body_turn, calendar::turn - 1_turns );
+        }
+        fast_forward_body_turn.reset();
+        u.update_body();
+    }
 
     // Auto-save if autosave is enabled
     if( get_option<bool>( "AUTOSAVE" ) &&
@@ -1478,6 +1542,15 @@ bool game::do_turn()
         !u.is_dead_state() ) {
         autosave();
     }
+    // Keep the submaps buffered in memory within the configured budget
+    const int mapbuffer_budget = get_option<int>( "MAPBUFFER_BUDGET" );
+    if( mapbuffer_budget > 0 && calendar::once_every( 1_minutes ) ) {
+        try {
+            MAPBUFFER.evict_to_budget( static_cast<size_t>( mapbuffer_budget ) * 1024 * 1024 );
+        } catch( const std::exception &err ) {
+            debugmsg( "Failed to evict map buffer: %s", err.what() );
+        }
+    }
 
     weather.update_weather();
     reset_light_level();
@@ -1618,7 +1691,7 @@ bool game::do_turn()
     update_stair_monsters();
     mon_info_update();
     u.process_turn();
-    if( u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
+    if( !fast_forwarding && u.moves < 0 && get_option<bool>( "FORCE_REDRAW" ) ) {
         ui_manager::redraw();
         refresh_display();
     }
@@ -1648,8 +1721,11 @@ bool game::do_turn()
         }
     }
     if( wait_redraw ) {
+        // Fast-forwarding skips the popup refreshes in between full redraws
+        const time_duration popup_refresh_rate = fast_forwarding ? wait_refresh_rate :
+                std::min( 1_minutes, wait_refresh_rate );
         if( g->first_redraw_since_waiting_started ||
-            calendar::once_every( std::min( 1_minutes, wait_refresh_rate ) ) ) {
+            calendar::once_every( popup_refresh_rate ) ) {
             if( first_redraw_since_waiting_started || calendar::once_every( wait_refresh_rate ) ) {
                 ui_manager::redraw();
             }
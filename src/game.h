@@ -880,6 +880,13 @@ class game
 
     private:
         void perhaps_add_random_npc();
+        /**
+         * Whether the current turn may be fast-forwarded: the player is asleep or waiting
+         * out a long stationary activity and nothing hostile is within view distance.
+         * While this holds, the player's body is only updated once per fast-forward step
+         * and the screen is redrawn less often, see @ref do_turn.
+         */
+        bool can_fast_forward();
 
         // Routine loop functions, approximately in order of execution
         void monmove();          // Monster movement
@@ -1080,6 +1087,8 @@ class game
         bool critter_died = false;
         /** Is this the first redraw since waiting (sleeping or activity) started */
         bool first_redraw_since_waiting_started = true;
+        /** Turn the player's body was last brought up to date on while fast-forwarding */
+        cata::optional<time_point> fast_forward_body_turn;
         /** Is Zone manager open or not - changes graphics of some zone tiles */
         bool zones_manager_open = false;
 
@@ -13,6 +13,7 @@
 #include "activity_actor_definitions.h"
 #include "activity_type.h"
 #include "advanced_inv.h"
+#include "animation.h"
 #include "auto_note.h"
 #include "auto_pickup.h"
 #include "avatar.h"
@@ -1591,6 +1592,7 @@ bool game::handle_action()
         return false;
     } else {
         // No auto-move, ask player for input
+        reset_animation_timeline();
         ctxt = get_player_input( action );
     }
 
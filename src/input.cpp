@@ -1546,6 +1546,23 @@ input_event input_context::get_raw_input()
     return next_action;
 }
 
+void input_manager::requeue_input_event( const input_event &event )
+{
+    requeued_events.push_back( event );
+}
+
+bool input_manager::take_requeued_event( input_event &event )
+{
+    if( requeued_events.empty() ) {
+        return false;
+    }
+    event = requeued_events.front();
+    requeued_events.pop_front();
+    previously_pressed_key = event.type == input_event_t::keyboard_char ?
+                             event.get_first_input() : 0;
+    return true;
+}
+
 int input_manager::get_previously_pressed_key() const
 {
     return previously_pressed_key;
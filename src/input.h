@@ -2,6 +2,7 @@
 #ifndef CATA_SRC_INPUT_H
 #define CATA_SRC_INPUT_H
 
+#include <deque>
 #include <functional>
 #include <iosfwd>
 #include <map>
@@ -355,6 +356,11 @@ class input_manager
          * Defined in the respective platform wrapper, e.g. sdlcurse.cpp
          */
         input_event get_input_event( keyboard_mode preferred_keyboard_mode = keyboard_mode::keycode );
+        /**
+         * Puts an event that was read but not handled back, the next call to @ref get_input_event
+         * returns it without waiting for new input.
+         */
+        void requeue_input_event( const input_event &event );
         /**
          * Resize & refresh if necessary, process all pending window events, and ignore keypresses
          */
@@ -419,6 +425,11 @@ class input_manager
 
         int input_timeout;
 
+        // See @ref requeue_input_event
+        std::deque<input_event> requeued_events;
+        /** Takes the oldest requeued event into `event`, returns false if there is none. */
+        bool take_requeued_event( input_event &event );
+
         t_input_event_list &get_or_create_event_list( const std::string &action_descriptor,
                 const std::string &context );
         void remove_input_for_action( const std::string &action_descriptor, const std::string &context );
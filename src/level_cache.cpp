@@ -1,19 +1,27 @@
 #include "level_cache.h"
 
 #include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "map.h"
 
 level_cache::level_cache()
 {
     const int map_dimensions = MAPSIZE_X * MAPSIZE_Y;
     transparency_cache_dirty.set();
     outside_cache_dirty = true;
-    floor_cache_dirty = false;
+    // Nothing has been built yet
+    floor_cache_dirty = true;
     constexpr four_quadrants four_zeros( 0.0f );
     std::fill_n( &lm[0][0], map_dimensions, four_zeros );
     std::fill_n( &sm[0][0], map_dimensions, 0.0f );
-    std::fill_n( &light_source_buffer[0][0], map_dimensions, 0.0f );
-    std::fill_n( &outside_cache[0][0], map_dimensions, false );
-    std::fill_n( &floor_cache[0][0], map_dimensions, false );
+    for( std::bitset<MAPSIZE_Y> &row : outside_cache ) {
+        row.reset();
+    }
+    for( std::bitset<MAPSIZE_Y> &row : floor_cache ) {
+        row.reset();
+    }
     std::fill_n( &transparency_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &vision_transparency_cache[0][0], map_dimensions, 0.0f );
     std::fill_n( &seen_cache[0][0], map_dimensions, 0.0f );
@@ -22,6 +30,75 @@ level_cache::level_cache()
     clear_vehicle_cache();
 }
 
+void level_cache::set_transparency_tile_dirty( const point &p )
+{
+    const size_t idx = static_cast<size_t>( p.x ) * MAPSIZE_Y + p.y;
+    if( !transparency_tile_dirty[idx] ) {
+        transparency_tile_dirty.set( idx );
+        transparency_dirty_tiles.push_back( p );
+    }
+}
+
+void level_cache::shift_transparency( const point &sm_shift )
+{
+    if( transparency_cache_dirty.all() ) {
+        // Everything gets rebuilt anyway
+        return;
+    }
+    const point d( sm_shift.x * SEEX, sm_shift.y * SEEY );
+    // Walk in the direction of the shift, so every tile is read before it is overwritten.
+    const int x_from = d.x >= 0 ? 0 : MAPSIZE_X - 1;
+    const int x_to = d.x >= 0 ? MAPSIZE_X : -1;
+    const int x_step = d.x >= 0 ? 1 : -1;
+    const int y_dst = std::max( 0, -d.y );
+    const int y_src = std::max( 0, d.y );
+    const size_t y_len = MAPSIZE_Y - std::abs( d.y );
+    for( int x = x_from; x != x_to; x += x_step ) {
+        const int src_x = x + d.x;
+        if( src_x < 0 || src_x >= MAPSIZE_X ) {
+            continue;
+        }
+        std::memmove( &transparency_cache[x][y_dst], &transparency_cache[src_x][y_src],
+                      y_len * sizeof( float ) );
+        transparent_cache_wo_fields[x] = d.y >= 0 ?
+                                         transparent_cache_wo_fields[src_x] >> d.y :
+                                         transparent_cache_wo_fields[src_x] << -d.y;
+    }
+
+    // The dirty submaps are stored x-major, unlike the caches shift_bitset_cache expects.
+    shift_bitset_cache<MAPSIZE, 1>( transparency_cache_dirty, point( sm_shift.y, sm_shift.x ) );
+    std::vector<point> dirty_tiles;
+    dirty_tiles.swap( transparency_dirty_tiles );
+    transparency_tile_dirty.reset();
+    for( const point &p : dirty_tiles ) {
+        const point shifted = p - d;
+        if( shifted.x >= 0 && shifted.x < MAPSIZE_X && shifted.y >= 0 && shifted.y < MAPSIZE_Y ) {
+            set_transparency_tile_dirty( shifted );
+        }
+    }
+
+    transparency_updated_all = true;
+    transparency_updated_tiles.clear();
+    vision_adjusted_tiles.clear();
+    r_hor_cache->invalidate();
+    r_up_cache->invalidate();
+}
+
+void level_cache::note_transparency_update( const point &p )
+{
+    if( transparency_updated_all ) {
+        return;
+    }
+    // Past this point copying the whole cache is cheaper than walking the list.
+    static constexpr size_t max_updated_tiles = MAPSIZE_X * MAPSIZE_Y / 8;
+    if( transparency_updated_tiles.size() >= max_updated_tiles ) {
+        transparency_updated_all = true;
+        transparency_updated_tiles.clear();
+        return;
+    }
+    transparency_updated_tiles.push_back( p );
+}
+
 bool level_cache::get_veh_in_active_range() const
 {
     return !veh_cached_parts.empty();
@@ -7,6 +7,7 @@
 #include <set>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "game_constants.h"
 #include "lightmap.h"
@@ -23,7 +24,17 @@ struct level_cache {
         level_cache();
         level_cache( const level_cache &other ) = default;
 
+        // Submaps whose transparency needs to be rebuilt as a whole
         std::bitset<MAPSIZE *MAPSIZE> transparency_cache_dirty;
+        // Single tiles whose transparency needs to be rebuilt, and the worklist of those tiles
+        std::bitset<MAPSIZE_X *MAPSIZE_Y> transparency_tile_dirty;
+        std::vector<point> transparency_dirty_tiles;
+        // Tiles of transparency_cache that changed since vision_transparency_cache last caught up.
+        // If transparency_updated_all is set, everything may have changed and the list is empty.
+        std::vector<point> transparency_updated_tiles;
+        bool transparency_updated_all = true;
+        // Tiles of vision_transparency_cache adjusted for the player's position and stance
+        std::vector<point> vision_adjusted_tiles;
         bool outside_cache_dirty = false;
         bool floor_cache_dirty = false;
         bool seen_cache_dirty = false;
@@ -32,19 +43,16 @@ struct level_cache {
 
         four_quadrants lm[MAPSIZE_X][MAPSIZE_Y];
         float sm[MAPSIZE_X][MAPSIZE_Y];
-        // To prevent redundant ray casting into neighbors: precalculate bulk light source positions.
-        // This is only valid for the duration of generate_lightmap
-        float light_source_buffer[MAPSIZE_X][MAPSIZE_Y];
 
         // if false, means tile is under the roof ("inside"), true means tile is "outside"
         // "inside" tiles are protected from sun, rain, etc. (see "INDOORS" flag)
-        bool outside_cache[MAPSIZE_X][MAPSIZE_Y];
+        std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X> outside_cache;
 
         // true when vehicle below has "ROOF" or "OPAQUE" part, furniture below has "SUN_ROOF_ABOVE"
         //      or terrain doesn't have "NO_FLOOR" flag
         // false otherwise
         // i.e. true == has floor
-        bool floor_cache[MAPSIZE_X][MAPSIZE_Y];
+        bitset_grid floor_cache;
 
         // stores cached transparency of the tiles
         // units: "transparency" (see LIGHT_TRANSPARENCY_OPEN_AIR)
@@ -87,6 +95,17 @@ struct level_cache {
         std::set<vehicle *> vehicle_list;
         std::set<vehicle *> zone_vehicles;
 
+        // Whether any submap or tile of transparency_cache needs to be rebuilt
+        bool transparency_dirty() const {
+            return transparency_cache_dirty.any() || !transparency_dirty_tiles.empty();
+        }
+        void set_transparency_tile_dirty( const point &p );
+        // Moves the transparency caches along with the map shifting by sm_shift submaps.
+        // The submaps entering the map are left clean, loading them marks them dirty.
+        void shift_transparency( const point &sm_shift );
+        // Records that the transparency of p changed, for the caches derived from it
+        void note_transparency_update( const point &p );
+
         bool get_veh_in_active_range() const;
         bool get_veh_exists_at( const tripoint &pt ) const;
         std::pair<vehicle *, int> get_veh_cached_parts( const tripoint &pt ) const;
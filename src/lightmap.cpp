@@ -91,7 +91,7 @@ bool map::build_transparency_cache( const int zlev )
     auto &transparency_cache = map_cache.transparency_cache;
     auto &outside_cache = map_cache.outside_cache;
 
-    if( map_cache.transparency_cache_dirty.none() ) {
+    if( !map_cache.transparency_dirty() ) {
         return false;
     }
 
@@ -105,69 +105,89 @@ bool map::build_transparency_cache( const int zlev )
         for( auto &row : transparent_cache_wo_fields ) {
             row.set(); // true means transparent
         }
+        map_cache.transparency_updated_all = true;
+        map_cache.transparency_updated_tiles.clear();
+        map_cache.r_hor_cache->invalidate();
+        map_cache.r_up_cache->invalidate();
     }
 
     const float sight_penalty = get_weather().weather_id->sight_penalty;
 
-    // Traverse the submaps in order
-    for( int smx = 0; smx < my_MAPSIZE; ++smx ) {
-        for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
-            const submap *cur_submap = get_submap_at_grid( {smx, smy, zlev} );
-            if( cur_submap == nullptr ) {
-                debugmsg( "Tried to build transparency cache at (%d,%d,%d) but the submap is not loaded", smx, smy,
-                          zlev );
+    // calculates transparency of a single tile
+    // p - coords in map local coords, sp - the same tile in submap coords
+    auto calc_transp = [&]( const submap * cur_submap, const point & p, const point & sp ) {
+        float value = LIGHT_TRANSPARENCY_OPEN_AIR;
+
+        if( !( cur_submap->get_ter( sp ).obj().transparent &&
+               cur_submap->get_furn( sp ).obj().transparent ) ) {
+            return std::make_pair( LIGHT_TRANSPARENCY_SOLID, LIGHT_TRANSPARENCY_SOLID );
+        }
+        if( outside_cache[p.x][p.y] ) {
+            // FIXME: Places inside vehicles haven't been marked as
+            // inside yet so this is incorrectly penalising for
+            // weather in vehicles.
+            value *= sight_penalty;
+        }
+        float value_wo_fields = value;
+        for( const auto &fld : cur_submap->get_field( sp ) ) {
+            const field_intensity_level &i_level = fld.second.get_intensity_level();
+            if( i_level.transparent ) {
                 continue;
             }
+            // Fields are either transparent or not, however we want some to be translucent
+            value = value * i_level.translucency;
+        }
+        // TODO: [lightmap] Have glass reduce light as well
+        return std::make_pair( value, value_wo_fields );
+    };
 
-            const point sm_offset = sm_to_ms_copy( point( smx, smy ) );
+    // Sets the opacity of a tile as seen by the reachability caches, and invalidates
+    // them only if it changed. A full rebuild invalidates them as a whole instead.
+    const auto set_transparent_wo_fields = [&]( const point & p, bool transparent ) {
+        if( transparent_cache_wo_fields[p.x][p.y] == transparent ) {
+            return;
+        }
+        transparent_cache_wo_fields[p.x][p.y] = transparent;
+        if( !rebuild_all ) {
+            map_cache.r_hor_cache->invalidate( p );
+            map_cache.r_up_cache->invalidate( p );
+        }
+    };
 
+    // Traverse the dirty submaps in order
+    for( int smx = 0; map_cache.transparency_cache_dirty.any() && smx < my_MAPSIZE; ++smx ) {
+        for( int smy = 0; smy < my_MAPSIZE; ++smy ) {
             if( !rebuild_all && !map_cache.transparency_cache_dirty[smx * MAPSIZE + smy] ) {
                 continue;
             }
 
-            // calculates transparency of a single tile
-            // x,y - coords in map local coords
-            auto calc_transp = [&]( const point & p ) {
-                const point sp = p - sm_offset;
-                float value = LIGHT_TRANSPARENCY_OPEN_AIR;
+            const submap *cur_submap = get_submap_at_grid( {smx, smy, zlev} );
+            if( cur_submap == nullptr ) {
+                debugmsg( "Tried to build transparency cache at (%d,%d,%d) but the submap is not loaded", smx, smy,
+                          zlev );
+                continue;
+            }
 
-                if( !( cur_submap->get_ter( sp ).obj().transparent &&
-                       cur_submap->get_furn( sp ).obj().transparent ) ) {
-                    return std::make_pair( LIGHT_TRANSPARENCY_SOLID, LIGHT_TRANSPARENCY_SOLID );
-                }
-                if( outside_cache[p.x][p.y] ) {
-                    // FIXME: Places inside vehicles haven't been marked as
-                    // inside yet so this is incorrectly penalising for
-                    // weather in vehicles.
-                    value *= sight_penalty;
-                }
-                float value_wo_fields = value;
-                for( const auto &fld : cur_submap->get_field( sp ) ) {
-                    const field_intensity_level &i_level = fld.second.get_intensity_level();
-                    if( i_level.transparent ) {
-                        continue;
+            const point sm_offset = sm_to_ms_copy( point( smx, smy ) );
+            if( !rebuild_all ) {
+                for( int sx = 0; sx < SEEX; ++sx ) {
+                    for( int sy = 0; sy < SEEY; ++sy ) {
+                        map_cache.note_transparency_update( sm_offset + point( sx, sy ) );
                     }
-                    // Fields are either transparent or not, however we want some to be translucent
-                    value = value * i_level.translucency;
                 }
-                // TODO: [lightmap] Have glass reduce light as well
-                return std::make_pair( value, value_wo_fields );
-            };
+            }
 
             if( cur_submap->is_uniform ) {
                 float value, dummy;
-                std::tie( value, dummy ) = calc_transp( sm_offset );
+                std::tie( value, dummy ) = calc_transp( cur_submap, sm_offset, point_zero );
                 // if rebuild_all==true all values were already set to LIGHT_TRANSPARENCY_OPEN_AIR
                 if( !rebuild_all || value != LIGHT_TRANSPARENCY_OPEN_AIR ) {
                     bool opaque = value <= LIGHT_TRANSPARENCY_SOLID;
                     for( int sx = 0; sx < SEEX; ++sx ) {
                         // init all sy indices in one go
                         std::uninitialized_fill_n( &transparency_cache[sm_offset.x + sx][sm_offset.y], SEEY, value );
-                        if( opaque ) {
-                            auto &bs = transparent_cache_wo_fields[sm_offset.x + sx];
-                            for( int i = 0; i < SEEY; i++ ) {
-                                bs[sm_offset.y + i] = false;
-                            }
+                        for( int i = 0; i < SEEY; i++ ) {
+                            set_transparent_wo_fields( sm_offset + point( sx, i ), !opaque );
                         }
                     }
                 }
@@ -177,13 +197,36 @@ bool map::build_transparency_cache( const int zlev )
                     for( int sy = 0; sy < SEEY; ++sy ) {
                         const int y = sy + sm_offset.y;
                         float transp_wo_fields;
-                        std::tie( transparency_cache[x][y], transp_wo_fields ) = calc_transp( {x, y } );
-                        transparent_cache_wo_fields[x][y] = transp_wo_fields > LIGHT_TRANSPARENCY_SOLID;
+                        std::tie( transparency_cache[x][y], transp_wo_fields ) =
+                            calc_transp( cur_submap, { x, y }, { sx, sy } );
+                        set_transparent_wo_fields( { x, y }, transp_wo_fields > LIGHT_TRANSPARENCY_SOLID );
                     }
                 }
             }
         }
     }
+
+    // Then the single dirty tiles outside of those submaps
+    for( const point &p : map_cache.transparency_dirty_tiles ) {
+        map_cache.transparency_tile_dirty.reset( static_cast<size_t>( p.x ) * MAPSIZE_Y + p.y );
+        const point smp = ms_to_sm_copy( p );
+        if( rebuild_all || map_cache.transparency_cache_dirty[smp.x * MAPSIZE + smp.y] ) {
+            continue;
+        }
+        const submap *cur_submap = get_submap_at_grid( { smp.x, smp.y, zlev } );
+        if( cur_submap == nullptr ) {
+            continue;
+        }
+        float transp_wo_fields;
+        const float old_value = transparency_cache[p.x][p.y];
+        std::tie( transparency_cache[p.x][p.y], transp_wo_fields ) =
+            calc_transp( cur_submap, p, p - sm_to_ms_copy( smp ) );
+        set_transparent_wo_fields( p, transp_wo_fields > LIGHT_TRANSPARENCY_SOLID );
+        if( transparency_cache[p.x][p.y] != old_value ) {
+            map_cache.note_transparency_update( p );
+        }
+    }
+    map_cache.transparency_dirty_tiles.clear();
     map_cache.transparency_cache_dirty.reset();
     return true;
 }
@@ -194,7 +237,20 @@ bool map::build_vision_transparency_cache( const int zlev )
     auto &transparency_cache = map_cache.transparency_cache;
     auto &vision_transparency_cache = map_cache.vision_transparency_cache;
 
-    memcpy( &vision_transparency_cache, &transparency_cache, sizeof( transparency_cache ) );
+    // Only copy the tiles that changed since the last time, and undo the previous adjustments.
+    if( map_cache.transparency_updated_all ) {
+        memcpy( &vision_transparency_cache, &transparency_cache, sizeof( transparency_cache ) );
+    } else {
+        for( const point &p : map_cache.transparency_updated_tiles ) {
+            vision_transparency_cache[p.x][p.y] = transparency_cache[p.x][p.y];
+        }
+        for( const point &p : map_cache.vision_adjusted_tiles ) {
+            vision_transparency_cache[p.x][p.y] = transparency_cache[p.x][p.y];
+        }
+    }
+    map_cache.transparency_updated_all = false;
+    map_cache.transparency_updated_tiles.clear();
+    map_cache.vision_adjusted_tiles.clear();
 
     Character &player_character = get_player_character();
     const tripoint &p = player_character.pos();
@@ -210,9 +266,11 @@ bool map::build_vision_transparency_cache( const int zlev )
         if( loc == p ) {
             // The tile player is standing on should always be visible
             vision_transparency_cache[p.x][p.y] = LIGHT_TRANSPARENCY_OPEN_AIR;
+            map_cache.vision_adjusted_tiles.push_back( p.xy() );
         } else if( is_crouching && coverage( loc ) >= 30 ) {
             // If we're crouching behind an obstacle, we can't see past it.
             vision_transparency_cache[loc.x][loc.y] = LIGHT_TRANSPARENCY_SOLID;
+            map_cache.vision_adjusted_tiles.push_back( loc.xy() );
             dirty = true;
         }
     }
@@ -244,7 +302,8 @@ void map::apply_character_light( Character &p )
 // Once this is complete, additional operations add more dynamic lighting.
 void map::build_sunlight_cache( int pzlev )
 {
-    const int zlev_min = zlevels ? -OVERMAP_DEPTH : pzlev;
+    // The levels below the cached ones are uniform rock, nothing to light there
+    const int zlev_min = zlevels ? cached_zlevs.first : pzlev;
     // Start at the topmost populated zlevel to avoid unnecessary raycasting
     // Plus one zlevel to prevent clipping inside structures
     const int zlev_max = zlevels ? clamp( calc_max_populated_zlev() + 1, pzlev + 1,
@@ -410,8 +469,12 @@ void map::generate_lightmap( const int zlev )
      * Step 3: ????
      * Step 4: Profit!
      */
-    auto &light_source_buffer = map_cache.light_source_buffer;
-    std::memset( light_source_buffer, 0, sizeof( light_source_buffer ) );
+    if( !light_source_buffer ) {
+        light_source_buffer = std::make_unique<light_source_grid>();
+    }
+    auto &light_source_luminance = light_source_buffer->luminance;
+    std::memset( light_source_luminance, 0, sizeof( light_source_luminance ) );
+    light_source_z = zlev;
 
     constexpr std::array<int, 4> dir_x = { {  0, -1, 1, 0 } };    //    [0]
     constexpr std::array<int, 4> dir_y = { { -1,  0, 0, 1 } };    // [1][X][2]
@@ -598,8 +661,8 @@ void map::generate_lightmap( const int zlev )
     const tripoint cache_start( 0, 0, zlev );
     const tripoint cache_end( LIGHTMAP_CACHE_X, LIGHTMAP_CACHE_Y, zlev );
     for( const tripoint &p : points_in_rectangle( cache_start, cache_end ) ) {
-        if( light_source_buffer[p.x][p.y] > 0.0 ) {
-            apply_light_source( p, light_source_buffer[p.x][p.y] );
+        if( light_source_luminance[p.x][p.y] > 0.0 ) {
+            apply_light_source( p, light_source_luminance[p.x][p.y] );
         }
     }
     for( const std::pair<tripoint, float> &elem : lm_override ) {
@@ -609,8 +672,12 @@ void map::generate_lightmap( const int zlev )
 
 void map::add_light_source( const tripoint &p, float luminance )
 {
-    auto &light_source_buffer = get_cache( p.z ).light_source_buffer;
-    light_source_buffer[p.x][p.y] = std::max( luminance, light_source_buffer[p.x][p.y] );
+    // Sources on other levels were never applied by generate_lightmap either.
+    if( p.z != light_source_z ) {
+        return;
+    }
+    float &buffered = light_source_buffer->luminance[p.x][p.y];
+    buffered = std::max( luminance, buffered );
 }
 
 // Tile light/transparency: 3D
@@ -656,6 +723,25 @@ bool map::is_transparent( const tripoint &p ) const
 
 float map::light_transparency( const tripoint &p ) const
 {
+    if( outside_cached_zlevs( p.z ) ) {
+        // No cache on this level, so apply the rules of build_transparency_cache to the tile
+        point l;
+        const submap *sm = inbounds( p ) ? get_submap_at( p, l ) : nullptr;
+        if( sm == nullptr || !( sm->get_ter( l ).obj().transparent &&
+                                sm->get_furn( l ).obj().transparent ) ) {
+            return LIGHT_TRANSPARENCY_SOLID;
+        }
+        float value = is_outside( p ) ?
+                      LIGHT_TRANSPARENCY_OPEN_AIR * get_weather().weather_id->sight_penalty :
+                      LIGHT_TRANSPARENCY_OPEN_AIR;
+        for( const auto &fld : sm->get_field( l ) ) {
+            const field_intensity_level &i_level = fld.second.get_intensity_level();
+            if( !i_level.transparent ) {
+                value *= i_level.translucency;
+            }
+        }
+        return value;
+    }
     return get_cache_ref( p.z ).transparency_cache[p.x][p.y];
 }
 
@@ -831,7 +917,8 @@ void castLight( Out( &output_cache )[MAPSIZE_X][MAPSIZE_Y],
                 const point &offset, int offsetDistance,
                 T numerator = VISIBILITY_FULL,
                 int row = 1, float start = 1.0f, float end = 0.0f,
-                T cumulative_transparency = T( LIGHT_TRANSPARENCY_OPEN_AIR ) );
+                T cumulative_transparency = T( LIGHT_TRANSPARENCY_OPEN_AIR ),
+                int max_radius = -1 );
 
 template<int xx, int xy, int yx, int yy, typename T, typename Out,
          T( *calc )( const T &, const T &, const int & ),
@@ -841,11 +928,15 @@ template<int xx, int xy, int yx, int yy, typename T, typename Out,
 void castLight( Out( &output_cache )[MAPSIZE_X][MAPSIZE_Y],
                 const T( &input_array )[MAPSIZE_X][MAPSIZE_Y],
                 const point &offset, const int offsetDistance, const T numerator,
-                const int row, float start, const float end, T cumulative_transparency )
+                const int row, float start, const float end, T cumulative_transparency,
+                const int max_radius )
 {
     constexpr quadrant quad = quadrant_from_x_y( -xx - xy, -yx - yy );
     float newStart = 0.0f;
     float radius = 60.0f - offsetDistance;
+    if( max_radius >= 0 && max_radius < radius ) {
+        radius = max_radius;
+    }
     if( start < end ) {
         return;
     }
@@ -898,7 +989,7 @@ void castLight( Out( &output_cache )[MAPSIZE_X][MAPSIZE_Y],
                 castLight<xx, xy, yx, yy, T, Out, calc, check, update_output, accumulate>(
                     output_cache, input_array, offset, offsetDistance,
                     numerator, distance + 1, start, trailingEdge,
-                    accumulate( cumulative_transparency, current_transparency, distance ) );
+                    accumulate( cumulative_transparency, current_transparency, distance ), max_radius );
             }
             // The new span starts at the leading edge of the previous square if it is opaque,
             // and at the trailing edge of the current square if it is transparent.
@@ -930,34 +1021,43 @@ template<typename T, typename Out, T( *calc )( const T &, const T &, const int &
          T( *accumulate )( const T &, const T &, const int & )>
 void castLightAll( Out( &output_cache )[MAPSIZE_X][MAPSIZE_Y],
                    const T( &input_array )[MAPSIZE_X][MAPSIZE_Y],
-                   const point &offset, int offsetDistance, T numerator )
+                   const point &offset, int offsetDistance, T numerator, int max_radius )
 {
+    const T open_air( LIGHT_TRANSPARENCY_OPEN_AIR );
     castLight<0, 1, 1, 0, T, Out, calc, check, update_output, accumulate>(
-        output_cache, input_array, offset, offsetDistance, numerator );
+        output_cache, input_array, offset, offsetDistance, numerator, 1, 1.0f, 0.0f, open_air,
+        max_radius );
     castLight<1, 0, 0, 1, T, Out, calc, check, update_output, accumulate>(
-        output_cache, input_array, offset, offsetDistance, numerator );
+        output_cache, input_array, offset, offsetDistance, numerator, 1, 1.0f, 0.0f, open_air,
+        max_radius );
 
     castLight < 0, -1, 1, 0, T, Out, calc, check, update_output, accumulate > (
-        output_cache, input_array, offset, offsetDistance, numerator );
+        output_cache, input_array, offset, offsetDistance, numerator, 1, 1.0f, 0.0f, open_air,
+        max_radius );
     castLight < -1, 0, 0, 1, T, Out, calc, check, update_output, accumulate > (
-        output_cache, input_array, offset, offsetDistance, numerator );
+        output_cache, input_array, offset, offsetDistance, numerator, 1, 1.0f, 0.0f, open_air,
+        max_radius );
 
     castLight < 0, 1, -1, 0, T, Out, calc, check, update_output, accumulate > (
-        output_cache, input_array, offset, offsetDistance, numerator );
+        output_cache, input_array, offset, offsetDistance, numerator, 1, 1.0f, 0.0f, open_air,
+        max_radius );
     castLight < 1, 0, 0, -1, T, Out, calc, check, update_output, accumulate > (
-        output_cache, input_array, offset, offsetDistance, numerator );
+        output_cache, input_array, offset, offsetDistance, numerator, 1, 1.0f, 0.0f, open_air,
+        max_radius );
 
     castLight < 0, -1, -1, 0, T, Out, calc, check, update_output, accumulate > (
-        output_cache, input_array, offset, offsetDistance, numerator );
+        output_cache, input_array, offset, offsetDistance, numerator, 1, 1.0f, 0.0f, open_air,
+        max_radius );
     castLight < -1, 0, 0, -1, T, Out, calc, check, update_output, accumulate > (
-        output_cache, input_array, offset, offsetDistance, numerator );
+        output_cache, input_array, offset, offsetDistance, numerator, 1, 1.0f, 0.0f, open_air,
+        max_radius );
 }
 
 template void castLightAll<float, four_quadrants, sight_calc, sight_check,
                            update_light_quadrants, accumulate_transparency>(
                                four_quadrants( &output_cache )[MAPSIZE_X][MAPSIZE_Y],
                                const float ( &input_array )[MAPSIZE_X][MAPSIZE_Y],
-                               const point &offset, int offsetDistance, float numerator );
+                               const point &offset, int offsetDistance, float numerator, int max_radius );
 
 template void
 castLightAll<fragment_cloud, fragment_cloud, shrapnel_calc, shrapnel_check,
@@ -965,7 +1065,7 @@ castLightAll<fragment_cloud, fragment_cloud, shrapnel_calc, shrapnel_check,
 (
     fragment_cloud( &output_cache )[MAPSIZE_X][MAPSIZE_Y],
     const fragment_cloud( &input_array )[MAPSIZE_X][MAPSIZE_Y],
-    const point &offset, int offsetDistance, fragment_cloud numerator );
+    const point &offset, int offsetDistance, fragment_cloud numerator, int max_radius );
 
 /**
  * Calculates the Field Of View for the provided map from the given x, y
@@ -993,6 +1093,9 @@ void map::build_seen_cache( const tripoint &origin, const int target_z )
 
     if( !fov_3d ) {
         for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+            if( z != target_z && find_cache( z ) == nullptr ) {
+                continue;
+            }
             auto &cur_cache = get_cache( z );
             if( z == target_z || cur_cache.seen_cache_dirty ) {
                 std::uninitialized_fill_n(
@@ -1010,9 +1113,19 @@ void map::build_seen_cache( const tripoint &origin, const int target_z )
         // Cache the caches (pointers to them)
         array_of_grids_of<const float> transparency_caches;
         array_of_grids_of<float> seen_caches;
-        array_of_grids_of<const bool> floor_caches;
+        array_of_bitset_grids floor_caches;
         vertical_direction directions_to_cast = vertical_direction::BOTH;
+        // Sight stops at the levels without caches, they are out of fov_3d_z_range anyway
+        static const float opaque_level[MAPSIZE_X][MAPSIZE_Y] = {};
+        static const bitset_grid floorless_level = {};
+        static float unseen_level[MAPSIZE_X][MAPSIZE_Y];
         for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+            if( outside_cached_zlevs( z ) ) {
+                transparency_caches[z + OVERMAP_DEPTH] = &opaque_level;
+                seen_caches[z + OVERMAP_DEPTH] = &unseen_level;
+                floor_caches[z + OVERMAP_DEPTH] = &floorless_level;
+                continue;
+            }
             auto &cur_cache = get_cache( z );
             transparency_caches[z + OVERMAP_DEPTH] = &cur_cache.vision_transparency_cache;
             seen_caches[z + OVERMAP_DEPTH] = &cur_cache.seen_cache;
@@ -1088,6 +1201,49 @@ void map::build_seen_cache( const tripoint &origin, const int target_z )
     }
 }
 
+bool map::sees_from_fov( const tripoint &F, const tripoint &T, const int range ) const
+{
+    if( F.z != T.z || range < 0 || range > MAX_VIEW_DISTANCE || !inbounds( F ) ) {
+        return sees( F, T, range );
+    }
+    if( range < rl_dist( F, T ) || !inbounds( T ) ) {
+        return false; // Out of range!
+    }
+
+    const int radius = std::max( range, 1 );
+    const fov_bitmap_cache::entry *cached = creature_fov_cache.find( F, radius );
+    if( cached == nullptr ) {
+        fov_bitmap_cache::entry &fresh = creature_fov_cache.slot( F );
+        // Grow to the largest range asked for so far, so viewers sharing the tile
+        // with different sight ranges don't keep recomputing it.
+        fresh.radius = std::max( fresh.radius, radius );
+        fresh.visible.reset();
+
+        // Shadowcasting never reaches past `radius` rows, so only that box needs clearing.
+        const point min( std::max( F.x - fresh.radius, 0 ), std::max( F.y - fresh.radius, 0 ) );
+        const point max( std::min( F.x + fresh.radius, MAPSIZE_X - 1 ),
+                         std::min( F.y + fresh.radius, MAPSIZE_Y - 1 ) );
+        float ( &seen )[MAPSIZE_X][MAPSIZE_Y] = creature_fov_cache.scratch().seen;
+        for( int x = min.x; x <= max.x; x++ ) {
+            std::uninitialized_fill_n( &seen[x][min.y], max.y - min.y + 1,
+                                       LIGHT_TRANSPARENCY_SOLID );
+        }
+        seen[F.x][F.y] = VISIBILITY_FULL;
+        castLightAll<float, float, sight_calc, sight_check, update_light, accumulate_transparency>(
+            seen, get_cache_ref( F.z ).transparency_cache, F.xy(), 0, VISIBILITY_FULL, fresh.radius );
+
+        for( int x = min.x; x <= max.x; x++ ) {
+            for( int y = min.y; y <= max.y; y++ ) {
+                if( seen[x][y] > LIGHT_TRANSPARENCY_SOLID ) {
+                    fresh.visible.set( fov_bitmap_cache::index( point( x, y ) ) );
+                }
+            }
+        }
+        cached = &fresh;
+    }
+    return cached->visible[fov_bitmap_cache::index( T.xy() )];
+}
+
 //Schraudolph's algorithm with John's constants
 static inline
 float fastexp( float x )
@@ -1125,7 +1281,10 @@ void map::apply_light_source( const tripoint &p, float luminance )
     four_quadrants( &lm )[MAPSIZE_X][MAPSIZE_Y] = cache.lm;
     float ( &sm )[MAPSIZE_X][MAPSIZE_Y] = cache.sm;
     float ( &transparency_cache )[MAPSIZE_X][MAPSIZE_Y] = cache.transparency_cache;
-    float ( &light_source_buffer )[MAPSIZE_X][MAPSIZE_Y] = cache.light_source_buffer;
+    // Outside of generate_lightmap for this level there are no buffered neighbours.
+    static const light_source_grid no_light_sources {};
+    const float ( &light_source_luminance )[MAPSIZE_X][MAPSIZE_Y] =
+        p.z == light_source_z ? light_source_buffer->luminance : no_light_sources.luminance;
 
     const point p2( p.xy() );
 
@@ -1157,10 +1316,10 @@ void map::apply_light_source( const tripoint &p, float luminance )
            sy
     */
     const int peer_inbounds = LIGHTMAP_CACHE_X - 1;
-    bool north = ( p2.y != 0 && light_source_buffer[p2.x][p2.y - 1] < luminance );
-    bool south = ( p2.y != peer_inbounds && light_source_buffer[p2.x][p2.y + 1] < luminance );
-    bool east = ( p2.x != peer_inbounds && light_source_buffer[p2.x + 1][p2.y] < luminance );
-    bool west = ( p2.x != 0 && light_source_buffer[p2.x - 1][p2.y] < luminance );
+    bool north = ( p2.y != 0 && light_source_luminance[p2.x][p2.y - 1] < luminance );
+    bool south = ( p2.y != peer_inbounds && light_source_luminance[p2.x][p2.y + 1] < luminance );
+    bool east = ( p2.x != peer_inbounds && light_source_luminance[p2.x + 1][p2.y] < luminance );
+    bool west = ( p2.x != 0 && light_source_luminance[p2.x - 1][p2.y] < luminance );
 
     if( north ) {
         castLight < 1, 0, 0, -1, float, four_quadrants, light_calc, light_check,
@@ -3,6 +3,7 @@
 #define CATA_SRC_LIGHTMAP_H
 
 #include <cmath>
+#include <cstdint>
 #include <ostream>
 
 static constexpr float LIGHT_SOURCE_LOCAL = 0.1f;
@@ -47,7 +48,8 @@ constexpr inline int LIGHT_RANGE( float b )
                              LIGHT_TRANSPARENCY_OPEN_AIR ) );
 }
 
-enum class lit_level : int {
+// Stored per tile in level_cache::visibility_cache, so kept to a single byte.
+enum class lit_level : uint8_t {
     DARK = 0,
     LOW, // Hard to see
     BRIGHT_ONLY, // bright but indistinct
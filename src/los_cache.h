@@ -0,0 +1,134 @@
+#pragma once
+#ifndef CATA_SRC_LOS_CACHE_H
+#define CATA_SRC_LOS_CACHE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "game_constants.h"
+#include "point.h"
+
+/**
+ * Fixed-size, direct-mapped cache of line-of-sight results between pairs of
+ * points inside the reality bubble.
+ *
+ * Each slot is a single packed 64-bit word holding the (order independent)
+ * pair of endpoints, the cached result and the generation it was written in.
+ * Lookups and insertions never allocate; a colliding insertion simply replaces
+ * the previous occupant of the slot. @ref clear bumps the generation, which
+ * invalidates every slot in O(1).
+ */
+class los_cache
+{
+    public:
+        /** Number of slots, must be a power of two. */
+        static constexpr int size_bits = 17;
+        static constexpr size_t size = size_t( 1 ) << size_bits;
+
+        /** Result of a lookup. */
+        enum class result : int {
+            unknown = -1,
+            blocked = 0,
+            visible = 1,
+        };
+
+        result get( const tripoint &from, const tripoint &to ) const {
+            if( !cacheable( from, to ) || !slots ) {
+                ++misses_;
+                return result::unknown;
+            }
+            const uint64_t key = pack( from, to );
+            const uint64_t slot = slots[index( key )];
+            if( ( slot & key_mask ) == key && ( slot >> generation_shift ) == generation ) {
+                ++hits_;
+                return ( slot & value_bit ) ? result::visible : result::blocked;
+            }
+            ++misses_;
+            return result::unknown;
+        }
+
+        void insert( const tripoint &from, const tripoint &to, bool visible ) {
+            if( !cacheable( from, to ) ) {
+                return;
+            }
+            if( !slots ) {
+                slots.reset( new uint64_t[size]() );
+            }
+            const uint64_t key = pack( from, to );
+            slots[index( key )] = key | ( visible ? value_bit : 0 ) |
+                                  ( generation << generation_shift );
+        }
+
+        /** Invalidates all entries. */
+        void clear() {
+            ++generation;
+            if( generation > generation_max ) {
+                // Generation counter wrapped, stale slots could alias the new generation.
+                if( slots ) {
+                    std::fill( slots.get(), slots.get() + size, uint64_t( 0 ) );
+                }
+                generation = 1;
+            }
+        }
+
+        /** Changes whenever the cache is cleared, i.e. whenever line of sight may have changed. */
+        uint64_t get_generation() const {
+            return generation;
+        }
+
+        uint64_t hits() const {
+            return hits_;
+        }
+        uint64_t misses() const {
+            return misses_;
+        }
+        void reset_stats() {
+            hits_ = 0;
+            misses_ = 0;
+        }
+
+    private:
+        // Per point: 8 bits x, 8 bits y, 5 bits z.
+        static constexpr int point_bits = 21;
+        static constexpr uint64_t key_mask = ( uint64_t( 1 ) << ( 2 * point_bits ) ) - 1;
+        static constexpr uint64_t value_bit = uint64_t( 1 ) << ( 2 * point_bits );
+        static constexpr int generation_shift = 2 * point_bits + 1;
+        static constexpr uint64_t generation_max =
+            ( uint64_t( 1 ) << ( 64 - generation_shift ) ) - 1;
+
+        static_assert( MAPSIZE_X <= 256 && MAPSIZE_Y <= 256,
+                       "map too large to pack into los_cache keys" );
+        static_assert( OVERMAP_LAYERS <= 32, "too many z-levels to pack into los_cache keys" );
+
+        static bool cacheable_point( const tripoint &p ) {
+            return p.x >= 0 && p.x < MAPSIZE_X && p.y >= 0 && p.y < MAPSIZE_Y &&
+                   p.z >= -OVERMAP_DEPTH && p.z <= OVERMAP_HEIGHT;
+        }
+        static bool cacheable( const tripoint &from, const tripoint &to ) {
+            return cacheable_point( from ) && cacheable_point( to );
+        }
+        static uint64_t pack_point( const tripoint &p ) {
+            return static_cast<uint64_t>( p.x ) << 13 | static_cast<uint64_t>( p.y ) << 5 |
+                   static_cast<uint64_t>( p.z + OVERMAP_DEPTH );
+        }
+        // Canonicalize the order of the points so the cache is reflexive.
+        static uint64_t pack( const tripoint &from, const tripoint &to ) {
+            const uint64_t a = pack_point( from );
+            const uint64_t b = pack_point( to );
+            return a < b ? a << point_bits | b : b << point_bits | a;
+        }
+        static size_t index( uint64_t key ) {
+            // Fibonacci hashing spreads neighbouring keys over the whole table.
+            return static_cast<size_t>( ( key * 0x9E3779B97F4A7C15ULL ) >> ( 64 - size_bits ) );
+        }
+
+        // Allocated on first insertion, so maps that never check visibility stay small.
+        std::unique_ptr<uint64_t[]> slots;
+        uint64_t generation = 1;
+        mutable uint64_t hits_ = 0;
+        mutable uint64_t misses_ = 0;
+};
+
+#endif // CATA_SRC_LOS_CACHE_H
@@ -533,3 +533,13 @@ bool enchantment::operator==( const enchantment &rhs ) const
            this->values_multiply == rhs.values_multiply &&
            this->values_add == rhs.values_add;
 }
+
+bool enchantment::same_total( const enchantment &rhs ) const
+{
+    return *this == rhs &&
+           emitter == rhs.emitter &&
+           ench_effects == rhs.ench_effects &&
+           hit_me_effect == rhs.hit_me_effect &&
+           hit_you_effect == rhs.hit_you_effect &&
+           intermittent_activation == rhs.intermittent_activation;
+}
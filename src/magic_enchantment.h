@@ -173,6 +173,11 @@ class enchantment
         }
 
         bool operator==( const enchantment &rhs ) const;
+        /**
+         * Unlike operator==, compares everything force_add sums up, including the emitter,
+         * effects and spells. For checking a cached total against a fresh one.
+         */
+        bool same_total( const enchantment &rhs ) const;
     private:
         std::set<trait_id> mutations;
         cata::optional<emit_id> emitter;
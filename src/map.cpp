@@ -119,6 +119,8 @@ static const std::string flag_DONT_REMOVE_ROTTEN( "DONT_REMOVE_ROTTEN" );
 static cata::colony<item> nulitems;          // Returned when &i_at() is asked for an OOB value
 static field              nulfield;          // Returned when &field_at() is asked for an OOB value
 static level_cache        nullcache;         // Dummy cache for z-levels outside bounds
+// The items of the shared tiles of uniform submaps, see map::i_at. Never written to.
+static const cata::colony<item> shared_tile_items;
 
 // Map stack methods.
 map_stack::iterator map_stack::erase( map_stack::const_iterator it )
@@ -153,14 +155,11 @@ map::map( int mapsize, bool zlev )
         grid.resize( static_cast<size_t>( my_MAPSIZE * my_MAPSIZE ), nullptr );
     }
 
+    // Matches the initial cached_zlevs, build_map_cache narrows it down later
     for( auto &ptr : caches ) {
         ptr = std::make_unique<level_cache>();
     }
 
-    for( auto &ptr : pathfinding_caches ) {
-        ptr = std::make_unique<pathfinding_cache>();
-    }
-
     dbg( D_INFO ) << "map::map(): my_MAPSIZE: " << my_MAPSIZE << " z-levels enabled:" << zlevels;
     traplocs.resize( trap::count() );
 }
@@ -222,9 +221,12 @@ void map::rebuild_vehicle_level_caches()
 
     for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
         // Cache all vehicles
-        level_cache &ch = get_cache( gridz );
+        level_cache *ch = find_cache( gridz );
+        if( ch == nullptr ) {
+            continue;
+        }
 
-        for( const auto &elem : ch.vehicle_list ) {
+        for( const auto &elem : ch->vehicle_list ) {
             add_vehicle_to_cache( elem );
         }
     }
@@ -243,10 +245,14 @@ void map::add_vehicle_to_cache( vehicle *veh )
             continue;
         }
         const tripoint p = veh->global_part_pos3( vpr.part() );
-        level_cache &ch = get_cache( p.z );
-        ch.set_veh_cached_parts( p, *veh, static_cast<int>( vpr.part_index() ) );
+        // update_cached_zlevs adds the vehicle once its level gets a cache
+        level_cache *ch = find_cache( p.z );
+        if( ch == nullptr ) {
+            continue;
+        }
+        ch->set_veh_cached_parts( p, *veh, static_cast<int>( vpr.part_index() ) );
         if( inbounds( p ) ) {
-            ch.set_veh_exists_at( p, true );
+            ch->set_veh_exists_at( p, true );
         }
     }
 }
@@ -258,36 +264,47 @@ void map::clear_vehicle_point_from_cache( vehicle *veh, const tripoint &pt )
         return;
     }
 
-    level_cache &ch = get_cache( pt.z );
+    level_cache *ch = find_cache( pt.z );
+    if( ch == nullptr ) {
+        return;
+    }
     if( inbounds( pt ) ) {
-        ch.set_veh_exists_at( pt, false );
+        ch->set_veh_exists_at( pt, false );
     }
-    ch.clear_veh_from_veh_cached_parts( pt, veh );
+    ch->clear_veh_from_veh_cached_parts( pt, veh );
 }
 
 void map::clear_vehicle_level_caches( )
 {
     for( int gridz = -OVERMAP_DEPTH; gridz <= OVERMAP_HEIGHT; gridz++ ) {
-        level_cache &ch = get_cache( gridz );
-        ch.clear_vehicle_cache();
+        level_cache *ch = find_cache( gridz );
+        if( ch != nullptr ) {
+            ch->clear_vehicle_cache();
+        }
     }
 }
 
 void map::clear_vehicle_list( const int zlev )
 {
-    auto &ch = get_cache( zlev );
-    ch.vehicle_list.clear();
-    ch.zone_vehicles.clear();
+    level_cache *ch = find_cache( zlev );
+    if( ch == nullptr ) {
+        return;
+    }
+    ch->vehicle_list.clear();
+    ch->zone_vehicles.clear();
 }
 
 void map::update_vehicle_list( const submap *const to, const int zlev )
 {
-    // Update vehicle data
-    level_cache &ch = get_cache( zlev );
+    // Update vehicle data, update_cached_zlevs collects them once the level gets a cache
+    level_cache *ch = find_cache( zlev );
+    if( ch == nullptr ) {
+        return;
+    }
     for( const auto &elem : to->vehicles ) {
-        ch.vehicle_list.insert( elem.get() );
+        ch->vehicle_list.insert( elem.get() );
         if( !elem->loot_zones.empty() ) {
-            ch.zone_vehicles.insert( elem.get() );
+            ch->zone_vehicles.insert( elem.get() );
         }
     }
 }
@@ -322,7 +339,7 @@ std::unique_ptr<vehicle> map::detach_vehicle( vehicle *veh )
         return std::unique_ptr<vehicle>();
     }
 
-    level_cache &ch = get_cache( z );
+    level_cache *ch = find_cache( z );
     for( size_t i = 0; i < current_submap->vehicles.size(); i++ ) {
         if( current_submap->vehicles[i].get() == veh ) {
             for( const tripoint &pt : veh->get_points() ) {
@@ -331,8 +348,10 @@ std::unique_ptr<vehicle> map::detach_vehicle( vehicle *veh )
                 get_avatar().clear_memorized_tile( getabs( pt ) );
                 set_memory_seen_cache_dirty( pt );
             }
-            ch.vehicle_list.erase( veh );
-            ch.zone_vehicles.erase( veh );
+            if( ch != nullptr ) {
+                ch->vehicle_list.erase( veh );
+                ch->zone_vehicles.erase( veh );
+            }
             std::unique_ptr<vehicle> result = std::move( current_submap->vehicles[i] );
             current_submap->vehicles.erase( current_submap->vehicles.begin() + i );
             if( veh->tracking_on ) {
@@ -370,8 +389,11 @@ void map::vehmove()
     int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     tripoint player_pos = get_player_location().pos();
     for( int zlev = minz; zlev <= maxz; ++zlev ) {
-        level_cache &cache = get_cache( zlev );
-        for( vehicle *veh : cache.vehicle_list ) {
+        const level_cache *cache = find_cache( zlev );
+        if( cache == nullptr ) {
+            continue;
+        }
+        for( vehicle *veh : cache->vehicle_list ) {
             if( veh->is_following ) {
                 veh->drive_to_local_target( getabs( player_pos ), true );
             } else if( veh->is_patrolling ) {
@@ -408,8 +430,10 @@ void map::vehmove()
     // The bool tracks whether the vehicles is on the map or not.
     std::map<vehicle *, bool> connected_vehicles;
     for( int zlev = minz; zlev <= maxz; ++zlev ) {
-        level_cache &cache = get_cache( zlev );
-        vehicle::enumerate_vehicles( connected_vehicles, cache.vehicle_list );
+        level_cache *cache = find_cache( zlev );
+        if( cache != nullptr ) {
+            vehicle::enumerate_vehicles( connected_vehicles, cache->vehicle_list );
+        }
     }
     for( std::pair<vehicle *const, bool> &veh_pair : connected_vehicles ) {
         veh_pair.first->idle( veh_pair.second );
@@ -865,7 +889,7 @@ float map::vehicle_vehicle_collision( vehicle &veh, vehicle &veh2,
 
 bool map::check_vehicle_zones( const int zlev )
 {
-    for( vehicle *veh : get_cache( zlev ).zone_vehicles ) {
+    for( vehicle *veh : get_cache_ref( zlev ).zone_vehicles ) {
         if( veh->zones_dirty ) {
             return true;
         }
@@ -877,7 +901,7 @@ std::vector<zone_data *> map::get_vehicle_zones( const int zlev )
 {
     std::vector<zone_data *> veh_zones;
     bool rebuild = false;
-    for( vehicle *veh : get_cache( zlev ).zone_vehicles ) {
+    for( vehicle *veh : get_cache_ref( zlev ).zone_vehicles ) {
         if( veh->refresh_zones() ) {
             rebuild = true;
         }
@@ -893,8 +917,10 @@ std::vector<zone_data *> map::get_vehicle_zones( const int zlev )
 
 void map::register_vehicle_zone( vehicle *veh, const int zlev )
 {
-    auto &ch = get_cache( zlev );
-    ch.zone_vehicles.insert( veh );
+    level_cache *ch = find_cache( zlev );
+    if( ch != nullptr ) {
+        ch->zone_vehicles.insert( veh );
+    }
 }
 
 bool map::deregister_vehicle_zone( zone_data &zone )
@@ -949,7 +975,7 @@ VehicleList map::get_vehicles( const tripoint &start, const tripoint &end )
 
 optional_vpart_position map::veh_at( const tripoint &p ) const
 {
-    if( !inbounds( p ) || !const_cast<map *>( this )->get_cache( p.z ).get_veh_in_active_range() ) {
+    if( !inbounds( p ) || !get_cache_ref( p.z ).get_veh_in_active_range() ) {
         return optional_vpart_position( cata::nullopt );
     }
 
@@ -965,7 +991,7 @@ optional_vpart_position map::veh_at( const tripoint &p ) const
 const vehicle *map::veh_at_internal( const tripoint &p, int &part_num ) const
 {
     // This function is called A LOT. Move as much out of here as possible.
-    const level_cache &ch = get_cache( p.z );
+    const level_cache &ch = get_cache_ref( p.z );
     if( !ch.get_veh_in_active_range() || !ch.get_veh_exists_at( p ) ) {
         part_num = -1;
         return nullptr; // Clear cache indicates no vehicle. This should optimize a great deal.
@@ -1206,7 +1232,7 @@ bool map::displace_vehicle( vehicle &veh, const tripoint &dp, const bool adjust_
         dst_submap->vehicles.push_back( std::move( *src_submap_veh_it ) );
         src_submap->vehicles.erase( src_submap_veh_it );
         dst_submap->is_uniform = false;
-        invalidate_max_populated_zlev( dst.z );
+        invalidate_populated_zlevs( dst.z );
     }
     if( need_update ) {
         g->update_map( player_character );
@@ -1223,13 +1249,10 @@ bool map::displace_vehicle( vehicle &veh, const tripoint &dp, const bool adjust_
         // delete the vehicle from the source z-level vehicle cache set if it is no longer on
         // that z-level
         if( src.z != dst.z ) {
-            level_cache &ch2 = get_cache( src.z );
-            for( const vehicle *elem : ch2.vehicle_list ) {
-                if( elem == &veh ) {
-                    ch2.vehicle_list.erase( &veh );
-                    ch2.zone_vehicles.erase( &veh );
-                    break;
-                }
+            level_cache *ch2 = find_cache( src.z );
+            if( ch2 != nullptr ) {
+                ch2->vehicle_list.erase( &veh );
+                ch2->zone_vehicles.erase( &veh );
             }
         }
         veh.check_is_heli_landed();
@@ -1401,7 +1424,7 @@ void map::furn_set( const tripoint &p, const furn_id &new_furniture, const bool
         set_floor_cache_dirty( p.z + 1 );
     }
 
-    invalidate_max_populated_zlev( p.z );
+    invalidate_populated_zlevs( p.z );
 
     set_memory_seen_cache_dirty( p );
 
@@ -1715,7 +1738,7 @@ bool map::ter_set( const tripoint &p, const ter_id &new_terrain )
         support_cache_dirty.insert( p );
         set_seen_cache_dirty( p );
     }
-    invalidate_max_populated_zlev( p.z );
+    invalidate_populated_zlevs( p.z );
 
     set_memory_seen_cache_dirty( p );
 
@@ -1813,7 +1836,8 @@ int map::move_cost( const tripoint &p, const vehicle *ignored_vehicle ) const
         return 0;
     }
     point l;
-    submap *const current_submap = unsafe_get_submap_at( p, l );
+    // Read only, so the tiles of uniform submaps stay shared
+    const submap *const current_submap = unsafe_get_submap_at( p, l );
     if( current_submap == nullptr ) {
         return 0;
     }
@@ -2611,6 +2635,18 @@ bool map::is_outside( const tripoint &p ) const
     if( !inbounds( p ) ) {
         return true;
     }
+    if( outside_cached_zlevs( p.z ) ) {
+        // No cache on this level, so apply the rules of build_outside_cache to the tile
+        if( p.z < 0 ) {
+            return false;
+        }
+        for( const tripoint &q : points_in_radius( p, 1 ) ) {
+            if( inbounds( q ) && has_flag_ter_or_furn( TFLAG_INDOORS, q ) ) {
+                return false;
+            }
+        }
+        return true;
+    }
 
     const auto &outside_cache = get_cache_ref( p.z ).outside_cache;
     return outside_cache[p.x][p.y];
@@ -2733,7 +2769,9 @@ void map::decay_fields_and_scent( const time_duration &amount )
                                    << abs_sub.x + smx << "," << abs_sub.y + smy << "," << abs_sub.z
                                    << "has " << to_proc << " field_count";
                 }
-                get_cache( smz ).field_cache.reset( smx + ( smy * MAPSIZE ) );
+                if( level_cache *ch = find_cache( smz ) ) {
+                    ch->field_cache.reset( smx + ( smy * MAPSIZE ) );
+                }
                 // This submap has no fields
                 continue;
             }
@@ -4204,6 +4242,11 @@ map_stack map::i_at( const tripoint &p )
         nulitems.clear();
         return map_stack{ &nulitems, p, this };
     }
+    if( current_submap->shares_tiles() ) {
+        // Shared uniform tiles never hold items. The stack stays empty: map_stack only changes
+        // its items through the map, and adding one copies the tiles, see add_item.
+        return map_stack{ const_cast<cata::colony<item> *>( &shared_tile_items ), p, this };
+    }
 
     return map_stack{ &current_submap->get_items( l ), p, this };
 }
@@ -4246,6 +4289,10 @@ void map::i_clear( const tripoint &p )
         debugmsg( "Tried to clear items at (%d,%d) but the submap is not loaded", l.x, l.y );
         return;
     }
+    if( current_submap->shares_tiles() ) {
+        // Nothing to clear on shared uniform tiles
+        return;
+    }
 
     for( item &it : current_submap->get_items( l ) ) {
         // remove from the active items cache (if it isn't there does nothing)
@@ -4492,8 +4539,10 @@ item &map::add_item( const tripoint &p, item new_item )
         new_item.set_var( "reveal_map_center_omt", ms_to_omt_copy( getabs( p ) ) );
     }
 
+    // Shared uniform tiles hold no items, so the submap needs its own before adding one
+    current_submap->unshare_tiles();
     current_submap->is_uniform = false;
-    invalidate_max_populated_zlev( p.z );
+    invalidate_populated_zlevs( p.z );
 
     current_submap->update_lum_add( l, new_item );
 
@@ -4748,9 +4797,12 @@ void map::process_items()
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     for( int gz = minz; gz <= maxz; ++gz ) {
-        level_cache &cache = access_cache( gz );
+        const level_cache *cache = find_cache( gz );
+        if( cache == nullptr ) {
+            continue;
+        }
         std::set<tripoint> submaps_with_vehicles;
-        for( vehicle *this_vehicle : cache.vehicle_list ) {
+        for( vehicle *this_vehicle : cache->vehicle_list ) {
             tripoint pos = this_vehicle->global_pos3();
             submaps_with_vehicles.emplace( pos.x / SEEX, pos.y / SEEY, pos.z );
         }
@@ -4960,7 +5012,7 @@ bool map::has_items( const tripoint &p ) const
     }
 
     point l;
-    submap *const current_submap = unsafe_get_submap_at( p, l );
+    const submap *const current_submap = unsafe_get_submap_at( p, l );
     if( current_submap == nullptr ) {
         debugmsg( "Tried to check items at (%d,%d) but the submap is not loaded", l.x, l.y );
         return false;
@@ -5301,7 +5353,7 @@ const field &map::field_at( const tripoint &p ) const
     }
 
     point l;
-    submap *const current_submap = unsafe_get_submap_at( p, l );
+    const submap *const current_submap = unsafe_get_submap_at( p, l );
     if( current_submap == nullptr ) {
         debugmsg( "Tried to get field at (%d,%d) but the submap is not loaded", l.x, l.y );
         nulfield = field();
@@ -5328,6 +5380,11 @@ field &map::field_at( const tripoint &p )
         nulfield = field();
         return nulfield;
     }
+    if( current_submap->shares_tiles() ) {
+        // Shared uniform tiles hold no fields, add_field copies them before adding one
+        nulfield = field();
+        return nulfield;
+    }
 
     return current_submap->get_field( l );
 }
@@ -5389,7 +5446,12 @@ int map::get_field_intensity( const tripoint &p, const field_type_id &type ) con
 bool map::has_field_at( const tripoint &p, bool check_bounds ) const
 {
     const tripoint sm = ms_to_sm_copy( p );
-    return ( !check_bounds || inbounds( p ) ) && get_cache( p.z ).field_cache[sm.x + sm.y * MAPSIZE];
+    if( check_bounds && !inbounds( p ) ) {
+        return false;
+    }
+    // Adding a field allocates the cache
+    const level_cache *ch = find_cache( p.z );
+    return ch != nullptr && ch->field_cache[sm.x + sm.y * MAPSIZE];
 }
 
 field_entry *map::get_field( const tripoint &p, const field_type_id &type ) const
@@ -5404,6 +5466,10 @@ field_entry *map::get_field( const tripoint &p, const field_type_id &type ) cons
         debugmsg( "Tried to get field at (%d,%d) but the submap is not loaded", l.x, l.y );
         return nullptr;
     }
+    if( current_submap->shares_tiles() ) {
+        // Shared uniform tiles never hold fields, don't copy them for a lookup
+        return nullptr;
+    }
 
     return current_submap->get_field( l ).find_field( type );
 }
@@ -5442,14 +5508,16 @@ bool map::add_field( const tripoint &p, const field_type_id &type_id, int intens
         debugmsg( "Tried to add field at (%d,%d) but the submap is not loaded", l.x, l.y );
         return false;
     }
+    // Shared uniform tiles hold no fields, so the submap needs its own before adding one
+    current_submap->unshare_tiles();
     current_submap->is_uniform = false;
-    invalidate_max_populated_zlev( p.z );
+    invalidate_populated_zlevs( p.z );
 
     if( current_submap->get_field( l ).add_field( type_id, intensity, age ) ) {
         //Only adding it to the count if it doesn't exist.
-        if( !current_submap->field_count++ ) {
-            get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
-                                                  p.y / SEEX ) * MAPSIZE ) ) );
+        level_cache *ch = find_cache( p.z );
+        if( !current_submap->field_count++ && ch != nullptr ) {
+            ch->field_cache.set( static_cast<size_t>( p.x / SEEX + ( ( p.y / SEEX ) * MAPSIZE ) ) );
         }
     }
 
@@ -5473,14 +5541,16 @@ void map::remove_field( const tripoint &p, const field_type_id &field_to_remove
 
 void map::on_field_modified( const tripoint &p, const field_type &fd_type )
 {
-    invalidate_max_populated_zlev( p.z );
+    invalidate_populated_zlevs( p.z );
 
-    get_cache( p.z ).field_cache.set( static_cast<size_t>( p.x / SEEX + ( (
-                                          p.y / SEEX ) * MAPSIZE ) ) );
+    // update_cached_zlevs sets the field flags once the level gets a cache
+    if( level_cache *ch = find_cache( p.z ) ) {
+        ch->field_cache.set( static_cast<size_t>( p.x / SEEX + ( ( p.y / SEEX ) * MAPSIZE ) ) );
+    }
 
     // Dirty the transparency cache now that field processing doesn't always do it
     if( fd_type.dirty_transparency_cache || !fd_type.is_transparent() ) {
-        set_transparency_cache_dirty( p, true );
+        set_transparency_cache_dirty( p );
         set_seen_cache_dirty( p );
     }
 
@@ -6176,17 +6246,9 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         bresenham_slope = 0;
         return false; // Out of range!
     }
-    // Cannonicalize the order of the tripoints so the cache is reflexive.
-    const tripoint &min = F < T ? F : T;
-    const tripoint &max = !( F < T ) ? F : T;
-    // A little gross, just pack the values into a point.
-    const point key(
-        min.x << 16 | min.y << 8 | ( min.z + OVERMAP_DEPTH ),
-        max.x << 16 | max.y << 8 | ( max.z + OVERMAP_DEPTH )
-    );
-    char cached = skew_vision_cache.get( key, -1 );
-    if( cached >= 0 ) {
-        return cached > 0;
+    const los_cache::result cached = skew_vision_cache.get( F, T );
+    if( cached != los_cache::result::unknown ) {
+        return cached == los_cache::result::visible;
     }
     bool visible = true;
 
@@ -6204,7 +6266,7 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
             }
             return true;
         } );
-        skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+        skew_vision_cache.insert( F, T, visible );
         return visible;
     }
 
@@ -6237,7 +6299,7 @@ bool map::sees( const tripoint &F, const tripoint &T, const int range,
         last_point = new_point;
         return true;
     } );
-    skew_vision_cache.insert( 100000, key, visible ? 1 : 0 );
+    skew_vision_cache.insert( F, T, visible );
     return visible;
 }
 
@@ -6687,7 +6749,11 @@ void map::shift( const point &sp )
     const int zmin = zlevels ? -OVERMAP_DEPTH : abs.z;
     const int zmax = zlevels ? OVERMAP_HEIGHT : abs.z;
     for( int gridz = zmin; gridz <= zmax; gridz++ ) {
-        for( vehicle *veh : get_cache( gridz ).vehicle_list ) {
+        const level_cache *ch = find_cache( gridz );
+        if( ch == nullptr ) {
+            continue;
+        }
+        for( vehicle *veh : ch->vehicle_list ) {
             veh->zones_dirty = true;
         }
     }
@@ -6695,100 +6761,73 @@ void map::shift( const point &sp )
     // Shift the map sx submaps to the right and sy submaps down.
     // sx and sy should never be bigger than +/-1.
     // absx and absy are our position in the world, for saving/loading purposes.
+    // The grid is a ring buffer, so moving its origin shifts every submap at once and only
+    // the edge leaving the map and the edge entering it need any further work.
+    const auto leaving = [&]( const point & gp ) {
+        return ( sp.x > 0 && gp.x == 0 ) || ( sp.x < 0 && gp.x == my_MAPSIZE - 1 ) ||
+               ( sp.y > 0 && gp.y == 0 ) || ( sp.y < 0 && gp.y == my_MAPSIZE - 1 );
+    };
+    const auto entering = [&]( const point & gp ) {
+        return leaving( point( my_MAPSIZE - 1 - gp.x, my_MAPSIZE - 1 - gp.y ) );
+    };
     clear_vehicle_level_caches();
     for( int gridz = zmin; gridz <= zmax; gridz++ ) {
-        // Clear vehicle list and rebuild after shift
-        // mlangsdorf 2020 - this is kind of insane, building the cache is not free, why are
-        // we doing this?
-        clear_vehicle_list( gridz );
-        shift_bitset_cache<MAPSIZE_X, SEEX>( get_cache( gridz ).map_memory_seen_cache, sp );
-        shift_bitset_cache<MAPSIZE, 1>( get_cache( gridz ).field_cache, sp );
-        if( sp.x >= 0 ) {
-            for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
-                if( sp.y >= 0 ) {
-                    for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
-                        if( ( sp.x > 0 && gridx == 0 ) || ( sp.y > 0 && gridy == 0 ) ) {
-                            submaps_with_active_items.erase( { abs.x + gridx, abs.y + gridy, gridz } );
-                        }
-                        if( gridx + sp.x < my_MAPSIZE && gridy + sp.y < my_MAPSIZE ) {
-                            copy_grid( tripoint( gridx, gridy, gridz ),
-                                       tripoint( gridx + sp.x, gridy + sp.y, gridz ) );
-                            submap *const cur_submap = get_submap_at_grid( {gridx, gridy, gridz} );
-                            if( cur_submap == nullptr ) {
-                                debugmsg( "Tried to update vehicle list at (%d,%d,%d) but the submap is not loaded", gridx, gridy,
-                                          gridz );
-                                continue;
-                            }
-                            update_vehicle_list( cur_submap, gridz );
-                        } else {
-                            loadn( tripoint( gridx, gridy, gridz ), true );
-                        }
-                    }
-                } else { // sy < 0; work through it backwards
-                    for( int gridy = my_MAPSIZE - 1; gridy >= 0; gridy-- ) {
-                        if( ( sp.x > 0 && gridx == 0 ) || gridy == my_MAPSIZE - 1 ) {
-                            submaps_with_active_items.erase( { abs.x + gridx, abs.y + gridy, gridz } );
-                        }
-                        if( gridx + sp.x < my_MAPSIZE && gridy + sp.y >= 0 ) {
-                            copy_grid( tripoint( gridx, gridy, gridz ),
-                                       tripoint( gridx + sp.x, gridy + sp.y, gridz ) );
-                            submap *const cur_submap = get_submap_at_grid( {gridx, gridy, gridz} );
-                            if( cur_submap == nullptr ) {
-                                debugmsg( "Tried to update vehicle list at (%d,%d,%d) but the submap is not loaded", gridx, gridy,
-                                          gridz );
-                                continue;
-                            }
-                            update_vehicle_list( cur_submap, gridz );
-                        } else {
-                            loadn( tripoint( gridx, gridy, gridz ), true );
-                        }
-                    }
+        level_cache *ch = find_cache( gridz );
+        if( ch != nullptr ) {
+            shift_bitset_cache<MAPSIZE_X, SEEX>( ch->map_memory_seen_cache, sp );
+            shift_bitset_cache<MAPSIZE, 1>( ch->field_cache, sp );
+            ch->shift_transparency( sp );
+        }
+        for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+            for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+                if( !leaving( point( gridx, gridy ) ) ) {
+                    continue;
                 }
-            }
-        } else { // sx < 0; work through it backwards
-            for( int gridx = my_MAPSIZE - 1; gridx >= 0; gridx-- ) {
-                if( sp.y >= 0 ) {
-                    for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
-                        if( gridx == my_MAPSIZE - 1 || ( sp.y > 0 && gridy == 0 ) ) {
-                            submaps_with_active_items.erase( { abs.x + gridx, abs.y + gridy, gridz } );
-                        }
-                        if( gridx + sp.x >= 0 && gridy + sp.y < my_MAPSIZE ) {
-                            copy_grid( tripoint( gridx, gridy, gridz ),
-                                       tripoint( gridx + sp.x, gridy + sp.y, gridz ) );
-                            submap *const cur_submap = get_submap_at_grid( {gridx, gridy, gridz} );
-                            if( cur_submap == nullptr ) {
-                                debugmsg( "Tried to update vehicle list at (%d,%d,%d) but the submap is not loaded", gridx, gridy,
-                                          gridz );
-                                continue;
-                            }
-                            update_vehicle_list( cur_submap, gridz );
-                        } else {
-                            loadn( tripoint( gridx, gridy, gridz ), true );
-                        }
-                    }
-                } else { // sy < 0; work through it backwards
-                    for( int gridy = my_MAPSIZE - 1; gridy >= 0; gridy-- ) {
-                        if( gridx == my_MAPSIZE - 1 || gridy == my_MAPSIZE - 1 ) {
-                            submaps_with_active_items.erase( { abs.x + gridx, abs.y + gridy, gridz } );
-                        }
-                        if( gridx + sp.x >= 0 && gridy + sp.y >= 0 ) {
-                            copy_grid( tripoint( gridx, gridy, gridz ),
-                                       tripoint( gridx + sp.x, gridy + sp.y, gridz ) );
-                            submap *const cur_submap = get_submap_at_grid( {gridx, gridy, gridz} );
-                            if( cur_submap == nullptr ) {
-                                debugmsg( "Tried to update vehicle list at (%d,%d,%d) but the submap is not loaded", gridx, gridy,
-                                          gridz );
-                                continue;
-                            }
-                            update_vehicle_list( cur_submap, gridz );
-                        } else {
-                            loadn( tripoint( gridx, gridy, gridz ), true );
-                        }
-                    }
+                submaps_with_active_items.erase( { abs.x + gridx, abs.y + gridy, gridz } );
+                const submap *const old_submap = get_submap_at_grid( { gridx, gridy, gridz } );
+                if( old_submap == nullptr || ch == nullptr ) {
+                    continue;
+                }
+                for( const auto &veh : old_submap->vehicles ) {
+                    ch->vehicle_list.erase( veh.get() );
+                    ch->zone_vehicles.erase( veh.get() );
                 }
             }
         }
+    }
+
+    grid_origin.x = ( grid_origin.x + sp.x + my_MAPSIZE ) % my_MAPSIZE;
+    grid_origin.y = ( grid_origin.y + sp.y + my_MAPSIZE ) % my_MAPSIZE;
 
+    for( int gridz = zmin; gridz <= zmax; gridz++ ) {
+        for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+            for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+                const tripoint gp( gridx, gridy, gridz );
+                if( entering( gp.xy() ) ) {
+                    continue;
+                }
+                submap *const cur_submap = get_submap_at_grid( gp );
+                if( cur_submap == nullptr ) {
+                    debugmsg( "Tried to update vehicle list at (%d,%d,%d) but the submap is not loaded", gridx, gridy,
+                              gridz );
+                    continue;
+                }
+                if( cur_submap->vehicles.empty() ) {
+                    continue;
+                }
+                for( auto &veh : cur_submap->vehicles ) {
+                    veh->sm_pos = gp;
+                }
+                update_vehicle_list( cur_submap, gridz );
+            }
+        }
+        for( int gridx = 0; gridx < my_MAPSIZE; gridx++ ) {
+            for( int gridy = 0; gridy < my_MAPSIZE; gridy++ ) {
+                if( entering( point( gridx, gridy ) ) ) {
+                    loadn( tripoint( gridx, gridy, gridz ), true );
+                }
+            }
+        }
     }
     rebuild_vehicle_level_caches();
 
@@ -6870,8 +6909,7 @@ static void generate_uniform( const tripoint &p, const ter_id &terrain_type )
     for( int xd = 0; xd <= 1; xd++ ) {
         for( int yd = 0; yd <= 1; yd++ ) {
             submap *sm = new submap();
-            sm->is_uniform = true;
-            sm->set_all_ter( terrain_type );
+            sm->set_uniform( terrain_type );
             sm->last_touched = calendar::turn;
             MAPBUFFER.add_submap( p + point( xd, yd ), sm );
         }
@@ -6928,8 +6966,11 @@ void map::loadn( const tripoint &grid, const bool update_vehicles, bool _actuali
         }
     }
 
-    // New submap changes the content of the map and all caches must be recalculated
-    set_transparency_cache_dirty( grid.z );
+    // New submap changes the content of the map and all caches must be recalculated.
+    // The transparency cache is rebuilt per submap, see level_cache::shift_transparency.
+    if( level_cache *ch = inbounds_z( grid.z ) ? find_cache( grid.z ) : nullptr ) {
+        ch->transparency_cache_dirty.set( grid.x * MAPSIZE + grid.y );
+    }
     set_seen_cache_dirty( grid.z );
     set_outside_cache_dirty( grid.z );
     set_floor_cache_dirty( grid.z );
@@ -6938,8 +6979,9 @@ void map::loadn( const tripoint &grid, const bool update_vehicles, bool _actuali
     if( !tmpsub->active_items.empty() ) {
         submaps_with_active_items.emplace( grid_abs_sub );
     }
-    if( tmpsub->field_count > 0 ) {
-        get_cache( grid.z ).field_cache.set( grid.x + grid.y * MAPSIZE );
+    level_cache *ch = find_cache( grid.z );
+    if( tmpsub->field_count > 0 && ch != nullptr ) {
+        ch->field_cache.set( grid.x + grid.y * MAPSIZE );
     }
 
     // Destroy bugged no-part vehicles
@@ -6960,14 +7002,13 @@ void map::loadn( const tripoint &grid, const bool update_vehicles, bool _actuali
     }
 
     // Update vehicle data
-    if( update_vehicles ) {
-        auto &map_cache = get_cache( grid.z );
+    if( update_vehicles && ch != nullptr ) {
         for( const auto &veh : tmpsub->vehicles ) {
             // Only add if not tracking already.
-            if( map_cache.vehicle_list.find( veh.get() ) == map_cache.vehicle_list.end() ) {
-                map_cache.vehicle_list.insert( veh.get() );
+            if( ch->vehicle_list.find( veh.get() ) == ch->vehicle_list.end() ) {
+                ch->vehicle_list.insert( veh.get() );
                 if( !veh->loot_zones.empty() ) {
-                    map_cache.zone_vehicles.insert( veh.get() );
+                    ch->zone_vehicles.insert( veh.get() );
                 }
             }
         }
@@ -7299,41 +7340,60 @@ void map::actualize( const tripoint &grid )
 
     // check spoiled stuff, and fill up funnels while we're at it
     process_items_in_submap( *tmpsub, grid );
-    for( int x = 0; x < SEEX; x++ ) {
-        for( int y = 0; y < SEEY; y++ ) {
-            const tripoint pnt = sm_to_ms_copy( grid ) + point( x, y );
-            const point p( x, y );
-            const furn_t &furn = *this->furn( pnt );
-            const ter_t &terr = *this->ter( pnt );
-            if( !furn.emissions.empty() ) {
-                field_furn_locs.push_back( pnt );
-            }
-            if( !terr.emissions.empty() ) {
-                field_ter_locs.push_back( pnt );
-            }
 
-            const auto trap_here = tmpsub->get_trap( p );
-            if( trap_here != tr_null ) {
-                traplocs[trap_here.to_i()].push_back( pnt );
-            }
-            const ter_t &ter = tmpsub->get_ter( p ).obj();
-            if( ter.trap != tr_null && ter.trap != tr_ledge ) {
-                traplocs[ter.trap.to_i()].push_back( pnt );
-            }
+    // Most submaps have none of the things looked at per tile below, skip those outright.
+    // The steps below take the whole time since the last visit at once.
+    const submap::actualize_summary &summary = tmpsub->get_actualize_summary();
+    const bool has_fields = tmpsub->field_count > 0;
+    if( summary.any() || has_fields ) {
+        for( int x = 0; x < SEEX; x++ ) {
+            for( int y = 0; y < SEEY; y++ ) {
+                const tripoint pnt = sm_to_ms_copy( grid ) + point( x, y );
+                const point p( x, y );
+                if( summary.emitters ) {
+                    const furn_t &furn = *this->furn( pnt );
+                    const ter_t &terr = *this->ter( pnt );
+                    if( !furn.emissions.empty() ) {
+                        field_furn_locs.push_back( pnt );
+                    }
+                    if( !terr.emissions.empty() ) {
+                        field_ter_locs.push_back( pnt );
+                    }
+                }
 
-            if( do_funnels ) {
-                fill_funnels( pnt, tmpsub->last_touched );
-            }
+                if( summary.traps ) {
+                    const auto trap_here = tmpsub->get_trap( p );
+                    if( trap_here != tr_null ) {
+                        traplocs[trap_here.to_i()].push_back( pnt );
+                    }
+                    const ter_t &ter = tmpsub->get_ter( p ).obj();
+                    if( ter.trap != tr_null && ter.trap != tr_ledge ) {
+                        traplocs[ter.trap.to_i()].push_back( pnt );
+                    }
+
+                    if( do_funnels ) {
+                        fill_funnels( pnt, tmpsub->last_touched );
+                    }
+                }
 
-            grow_plant( pnt );
+                if( summary.plants ) {
+                    grow_plant( pnt );
+                }
 
-            restock_fruits( pnt, time_since_last_actualize );
+                if( summary.regrowing ) {
+                    restock_fruits( pnt, time_since_last_actualize );
 
-            produce_sap( pnt, time_since_last_actualize );
+                    produce_sap( pnt, time_since_last_actualize );
+                }
 
-            rad_scorch( pnt, time_since_last_actualize );
+                if( summary.radiation ) {
+                    rad_scorch( pnt, time_since_last_actualize );
+                }
 
-            decay_cosmetic_fields( pnt, time_since_last_actualize );
+                if( has_fields ) {
+                    decay_cosmetic_fields( pnt, time_since_last_actualize );
+                }
+            }
         }
     }
 
@@ -7388,20 +7448,6 @@ void map::add_roofs( const tripoint &grid )
     }
 }
 
-void map::copy_grid( const tripoint &to, const tripoint &from )
-{
-    submap *smap = get_submap_at_grid( from );
-    if( smap == nullptr ) {
-        debugmsg( "Tried to copy grid from (%d,%d,%d) but the submap is not loaded", from.x, from.y,
-                  from.z );
-        return;
-    }
-    setsubmap( get_nonant( to ), smap );
-    for( auto &it : smap->vehicles ) {
-        it->sm_pos = to;
-    }
-}
-
 void map::spawn_monsters_submap_group( const tripoint &gp, mongroup &group, bool ignore_sight )
 {
     Character &player_character = get_player_character();
@@ -7838,8 +7884,9 @@ void map::build_outside_cache( const int zlev )
 
     auto &outside_cache = ch.outside_cache;
     if( zlev < 0 ) {
-        std::uninitialized_fill_n(
-            &outside_cache[0][0], ( MAPSIZE_X ) * ( MAPSIZE_Y ), false );
+        for( std::bitset<MAPSIZE_Y> &row : outside_cache ) {
+            row.reset();
+        }
         return;
     }
 
@@ -7876,7 +7923,10 @@ void map::build_outside_cache( const int zlev )
 
     // Copy the padded cache back to the proper one, but with no padding
     for( int x = 0; x < SEEX * my_MAPSIZE; x++ ) {
-        std::copy_n( &padded_cache[x + 1][1], SEEX * my_MAPSIZE, &outside_cache[x][0] );
+        std::bitset<MAPSIZE_Y> &row = outside_cache[x];
+        for( int y = 0; y < SEEY * my_MAPSIZE; y++ ) {
+            row[y] = padded_cache[x + 1][y + 1];
+        }
     }
 
     ch.outside_cache_dirty = false;
@@ -7989,8 +8039,9 @@ bool map::build_floor_cache( const int zlev )
     }
 
     auto &floor_cache = ch.floor_cache;
-    std::uninitialized_fill_n(
-        &floor_cache[0][0], ( MAPSIZE_X ) * ( MAPSIZE_Y ), true );
+    for( std::bitset<MAPSIZE_Y> &row : floor_cache ) {
+        row.set();
+    }
     bool &no_floor_gaps = ch.no_floor_gaps;
     no_floor_gaps = true;
 
@@ -8035,8 +8086,8 @@ bool map::build_floor_cache( const int zlev )
 
 void map::build_floor_caches()
 {
-    const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
-    const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
+    const int minz = zlevels ? cached_zlevs.first : abs_sub.z;
+    const int maxz = zlevels ? cached_zlevs.second : abs_sub.z;
     for( int z = minz; z <= maxz; z++ ) {
         build_floor_cache( z );
     }
@@ -8056,7 +8107,10 @@ static void vehicle_caching_internal( level_cache &zch, const vpart_reference &v
     if( vehicle_is_opaque ) {
         int dpart = v->part_with_feature( part, VPFLAG_OPENABLE, true );
         if( dpart < 0 || !v->part( dpart ).open ) {
-            transparency_cache[part_pos.x][part_pos.y] = LIGHT_TRANSPARENCY_SOLID;
+            if( transparency_cache[part_pos.x][part_pos.y] != LIGHT_TRANSPARENCY_SOLID ) {
+                transparency_cache[part_pos.x][part_pos.y] = LIGHT_TRANSPARENCY_SOLID;
+                zch.note_transparency_update( part_pos.xy() );
+            }
         } else {
             vehicle_is_opaque = false;
         }
@@ -8090,17 +8144,92 @@ void map::do_vehicle_caching( int z )
                 continue;
             }
             vehicle_caching_internal( get_cache( part_pos.z ), vp, v );
-            if( part_pos.z < OVERMAP_HEIGHT ) {
-                vehicle_caching_internal_above( get_cache( part_pos.z + 1 ), vp, v );
+            level_cache *above = part_pos.z < OVERMAP_HEIGHT ?
+                                 find_cache( part_pos.z + 1 ) : nullptr;
+            if( above != nullptr ) {
+                vehicle_caching_internal_above( *above, vp, v );
+            }
+        }
+    }
+}
+
+void map::update_cached_zlevs( const int zlev )
+{
+    if( !zlevels ) {
+        cached_zlevs = { zlev, zlev };
+        return;
+    }
+    // The levels next to the viewer are needed for floors and sunlight even without 3D vision
+    const int z_range = std::max( fov_3d ? fov_3d_z_range : 0, 1 );
+    const int player_z = get_player_character().posz();
+    int minz = std::max( std::min( zlev, player_z ) - z_range, -OVERMAP_DEPTH );
+    int maxz = std::min( std::max( zlev, player_z ) + z_range, OVERMAP_HEIGHT );
+    // Sunlight is cast down starting just above the topmost populated level
+    maxz = std::max( maxz, std::min( calc_max_populated_zlev() + 1, OVERMAP_HEIGHT ) );
+    minz = std::min( minz, calc_min_populated_zlev() );
+    // Vehicles and fields don't make their submaps non-uniform, so look for them on the
+    // submaps: the caches of the levels outside of the range don't track them
+    const auto holds_vehicles_or_fields = [this]( const int z ) {
+        for( int gx = 0; gx < my_MAPSIZE; gx++ ) {
+            for( int gy = 0; gy < my_MAPSIZE; gy++ ) {
+                const submap *sm = get_submap_at_grid( { gx, gy, z } );
+                if( sm != nullptr && ( !sm->vehicles.empty() || sm->field_count > 0 ) ) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    };
+    for( int z = -OVERMAP_DEPTH; z < minz; z++ ) {
+        if( holds_vehicles_or_fields( z ) ) {
+            minz = z;
+            break;
+        }
+    }
+    for( int z = OVERMAP_HEIGHT; z > maxz; z-- ) {
+        if( holds_vehicles_or_fields( z ) ) {
+            maxz = z;
+            break;
+        }
+    }
+    cached_zlevs = { minz, maxz };
+
+    bool added_vehicles = false;
+    for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
+        std::unique_ptr<level_cache> &ch = caches[z + OVERMAP_DEPTH];
+        if( z < minz || z > maxz ) {
+            ch.reset();
+            continue;
+        }
+        if( ch ) {
+            continue;
+        }
+        // A new cache starts out dirty, but the vehicles and fields have to be collected
+        ch = std::make_unique<level_cache>();
+        for( int gx = 0; gx < my_MAPSIZE; gx++ ) {
+            for( int gy = 0; gy < my_MAPSIZE; gy++ ) {
+                const submap *sm = get_submap_at_grid( { gx, gy, z } );
+                if( sm == nullptr ) {
+                    continue;
+                }
+                if( sm->field_count > 0 ) {
+                    ch->field_cache.set( gx + gy * MAPSIZE );
+                }
+                added_vehicles |= !sm->vehicles.empty();
+                update_vehicle_list( sm, z );
             }
         }
     }
+    if( added_vehicles ) {
+        rebuild_vehicle_level_caches();
+    }
 }
 
 void map::build_map_cache( const int zlev, bool skip_lightmap )
 {
-    const int minz = zlevels ? -OVERMAP_DEPTH : zlev;
-    const int maxz = zlevels ? OVERMAP_HEIGHT : zlev;
+    update_cached_zlevs( zlev );
+    const int minz = cached_zlevs.first;
+    const int maxz = cached_zlevs.second;
     bool seen_cache_dirty = false;
     for( int z = minz; z <= maxz; z++ ) {
         // trigger FOV recalculation only when there is a change on the player's level or if fov_3d is enabled
@@ -8109,8 +8238,9 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
         build_transparency_cache( z );
         bool floor_cache_was_dirty = build_floor_cache( z );
         seen_cache_dirty |= ( floor_cache_was_dirty && affects_seen_cache );
-        if( floor_cache_was_dirty && z > -OVERMAP_DEPTH ) {
-            get_cache( z - 1 ).r_up_cache->invalidate();
+        level_cache *below = z > -OVERMAP_DEPTH ? find_cache( z - 1 ) : nullptr;
+        if( floor_cache_was_dirty && below != nullptr ) {
+            below->r_up_cache->invalidate();
         }
         seen_cache_dirty |= get_cache( z ).seen_cache_dirty && affects_seen_cache;
     }
@@ -8124,6 +8254,7 @@ void map::build_map_cache( const int zlev, bool skip_lightmap )
 
     if( seen_cache_dirty ) {
         skew_vision_cache.clear();
+        creature_fov_cache.clear();
     }
     // Initial value is illegal player position.
     const tripoint &p = get_player_character().pos();
@@ -8204,11 +8335,20 @@ size_t map::get_nonant( const tripoint &gridp ) const
         return 0;
     }
 
+    // Both operands are in [0, my_MAPSIZE), so a single subtraction wraps them.
+    int x = gridp.x + grid_origin.x;
+    if( x >= my_MAPSIZE ) {
+        x -= my_MAPSIZE;
+    }
+    int y = gridp.y + grid_origin.y;
+    if( y >= my_MAPSIZE ) {
+        y -= my_MAPSIZE;
+    }
     if( zlevels ) {
         const int indexz = gridp.z + OVERMAP_HEIGHT; // Can't be lower than 0
-        return indexz + ( gridp.x + gridp.y * my_MAPSIZE ) * OVERMAP_LAYERS;
+        return indexz + ( x + y * my_MAPSIZE ) * OVERMAP_LAYERS;
     } else {
-        return gridp.x + gridp.y * my_MAPSIZE;
+        return x + y * my_MAPSIZE;
     }
 }
 
@@ -8620,10 +8760,18 @@ std::list<Creature *> map::get_creatures_in_radius( const tripoint &center, size
     return creatures;
 }
 
+const level_cache &map::empty_cache()
+{
+    static const level_cache empty;
+    return empty;
+}
+
 level_cache &map::access_cache( int zlev )
 {
     if( zlev >= -OVERMAP_DEPTH && zlev <= OVERMAP_HEIGHT ) {
-        return *caches[zlev + OVERMAP_DEPTH];
+        // Changes to a level without a cache are dropped, it is built from scratch later
+        level_cache *ch = find_cache( zlev );
+        return ch != nullptr ? *ch : nullcache;
     }
 
     debugmsg( "access_cache called with invalid z-level: %d", zlev );
@@ -8633,7 +8781,7 @@ level_cache &map::access_cache( int zlev )
 const level_cache &map::access_cache( int zlev ) const
 {
     if( zlev >= -OVERMAP_DEPTH && zlev <= OVERMAP_HEIGHT ) {
-        return *caches[zlev + OVERMAP_DEPTH];
+        return get_cache_ref( zlev );
     }
 
     debugmsg( "access_cache called with invalid z-level: %d", zlev );
@@ -8649,13 +8797,18 @@ pathfinding_cache::~pathfinding_cache() = default;
 
 pathfinding_cache &map::get_pathfinding_cache( int zlev ) const
 {
-    return *pathfinding_caches[zlev + OVERMAP_DEPTH];
+    std::unique_ptr<pathfinding_cache> &cache = pathfinding_caches[zlev + OVERMAP_DEPTH];
+    if( !cache ) {
+        cache = std::make_unique<pathfinding_cache>();
+    }
+    return *cache;
 }
 
 void map::set_pathfinding_cache_dirty( const int zlev )
 {
-    if( inbounds_z( zlev ) ) {
-        get_pathfinding_cache( zlev ).dirty = true;
+    // A cache that is not allocated yet starts out dirty
+    if( inbounds_z( zlev ) && pathfinding_caches[zlev + OVERMAP_DEPTH] ) {
+        pathfinding_caches[zlev + OVERMAP_DEPTH]->dirty = true;
     }
 }
 
@@ -8663,7 +8816,7 @@ const pathfinding_cache &map::get_pathfinding_cache_ref( int zlev ) const
 {
     if( !inbounds_z( zlev ) ) {
         debugmsg( "Tried to get pathfinding cache for out of bounds z-level %d", zlev );
-        return *pathfinding_caches[ OVERMAP_DEPTH ];
+        return get_pathfinding_cache( 0 );
     }
     auto &cache = get_pathfinding_cache( zlev );
     if( cache.dirty ) {
@@ -8849,18 +9002,52 @@ int map::calc_max_populated_zlev()
     return max_z;
 }
 
-void map::invalidate_max_populated_zlev( int zlev )
+int map::calc_min_populated_zlev()
+{
+    // cache is filled and valid, skip recalculation
+    if( min_populated_zlev && min_populated_zlev->first == get_abs_sub() ) {
+        return min_populated_zlev->second;
+    }
+
+    // We'll assume ground level is populated
+    int min_z = 0;
+
+    for( int sz = -OVERMAP_DEPTH; sz < 0 && min_z == 0; sz++ ) {
+        for( int sx = 0; sx < my_MAPSIZE && min_z == 0; sx++ ) {
+            for( int sy = 0; sy < my_MAPSIZE; sy++ ) {
+                const submap *sm = get_submap_at_grid( tripoint( sx, sy, sz ) );
+                if( sm == nullptr ) {
+                    debugmsg( "Tried to calc min populated zlev at (%d,%d,%d) but the submap is not loaded", sx, sy,
+                              sz );
+                    continue;
+                }
+                if( !sm->is_uniform ) {
+                    min_z = sz;
+                    break;
+                }
+            }
+        }
+    }
+
+    min_populated_zlev = std::pair<tripoint, int>( get_abs_sub(), min_z );
+    return min_z;
+}
+
+void map::invalidate_populated_zlevs( int zlev )
 {
     if( max_populated_zlev && max_populated_zlev->second < zlev ) {
         max_populated_zlev->second = zlev;
     }
+    if( min_populated_zlev && min_populated_zlev->second > zlev ) {
+        min_populated_zlev->second = zlev;
+    }
 }
 
 // Get cache value for debug purposes
 int map::reachability_cache_value( const tripoint &p, bool vertical_cache,
                                    reachability_cache_quadrant quadrant ) const
 {
-    if( !inbounds( p ) ) {
+    if( !inbounds( p ) || find_cache( p.z ) == nullptr ) {
         return -2;
     }
 
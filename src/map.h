@@ -25,13 +25,14 @@
 #include "coordinate_conversions.h"
 #include "coordinates.h"
 #include "enums.h"
+#include "fov_bitmap_cache.h"
 #include "game_constants.h"
 #include "item.h"
 #include "item_stack.h"
 #include "level_cache.h"
 #include "lightmap.h"
 #include "line.h"
-#include "lru_cache.h"
+#include "los_cache.h"
 #include "map_selector.h"
 #include "mapdata.h"
 #include "optional.h"
@@ -337,60 +338,56 @@ class map
          */
         /*@{*/
         void set_transparency_cache_dirty( const int zlev ) {
-            if( inbounds_z( zlev ) ) {
-                get_cache( zlev ).transparency_cache_dirty.set();
-                get_cache( zlev ).r_hor_cache->invalidate();
-                get_cache( zlev ).r_up_cache->invalidate();
+            level_cache *ch = inbounds_z( zlev ) ? find_cache( zlev ) : nullptr;
+            if( ch != nullptr ) {
+                ch->transparency_cache_dirty.set();
+                ch->r_hor_cache->invalidate();
+                ch->r_up_cache->invalidate();
             }
         }
 
         // more granular version of the transparency cache invalidation
         // preferred over map::set_transparency_cache_dirty( const int zlev )
         // p is in local coords ("ms")
-        // @param field denotes if change comes from the field
-        //      fields are not considered for some caches, such as reachability_caches
-        //      so passing field=true allows to skip rebuilding of such caches
-        void set_transparency_cache_dirty( const tripoint &p, bool field = false ) {
-            if( inbounds( p ) ) {
-                const tripoint smp = ms_to_sm_copy( p );
-                get_cache( smp.z ).transparency_cache_dirty.set( smp.x * MAPSIZE + smp.y );
-                if( !field ) {
-                    get_cache( smp.z ).r_hor_cache->invalidate( p.xy() );
-                    get_cache( smp.z ).r_up_cache->invalidate( p.xy() );
-                }
+        // the reachability caches are invalidated by build_transparency_cache,
+        // and only on the tiles whose opacity actually changed
+        void set_transparency_cache_dirty( const tripoint &p ) {
+            level_cache *ch = inbounds( p ) ? find_cache( p.z ) : nullptr;
+            if( ch != nullptr ) {
+                ch->set_transparency_tile_dirty( p.xy() );
             }
         }
 
         void set_seen_cache_dirty( const tripoint &change_location ) {
-            if( inbounds( change_location ) ) {
-                level_cache &cache = get_cache( change_location.z );
-                if( cache.seen_cache_dirty ) {
-                    return;
-                }
-                if( cache.seen_cache[change_location.x][change_location.y] != 0.0 ||
-                    cache.camera_cache[change_location.x][change_location.y] != 0.0 ) {
-                    cache.seen_cache_dirty = true;
-                }
+            level_cache *cache = inbounds( change_location ) ? find_cache( change_location.z ) : nullptr;
+            if( cache == nullptr || cache->seen_cache_dirty ) {
+                return;
+            }
+            if( cache->seen_cache[change_location.x][change_location.y] != 0.0 ||
+                cache->camera_cache[change_location.x][change_location.y] != 0.0 ) {
+                cache->seen_cache_dirty = true;
             }
         }
 
         // invalidates seen cache for the whole zlevel unconditionally
         void set_seen_cache_dirty( const int zlevel ) {
-            if( inbounds_z( zlevel ) ) {
-                level_cache &cache = get_cache( zlevel );
-                cache.seen_cache_dirty = true;
+            level_cache *cache = inbounds_z( zlevel ) ? find_cache( zlevel ) : nullptr;
+            if( cache != nullptr ) {
+                cache->seen_cache_dirty = true;
             }
         }
 
         void set_outside_cache_dirty( const int zlev ) {
-            if( inbounds_z( zlev ) ) {
-                get_cache( zlev ).outside_cache_dirty = true;
+            level_cache *ch = inbounds_z( zlev ) ? find_cache( zlev ) : nullptr;
+            if( ch != nullptr ) {
+                ch->outside_cache_dirty = true;
             }
         }
 
         void set_floor_cache_dirty( const int zlev ) {
-            if( inbounds_z( zlev ) ) {
-                get_cache( zlev ).floor_cache_dirty = true;
+            level_cache *ch = inbounds_z( zlev ) ? find_cache( zlev ) : nullptr;
+            if( ch != nullptr ) {
+                ch->floor_cache_dirty = true;
             }
         }
 
@@ -399,29 +396,34 @@ class map
 
         void set_memory_seen_cache_dirty( const tripoint &p ) {
             const int offset = p.x + p.y * MAPSIZE_Y;
-            if( offset >= 0 && offset < MAPSIZE_X * MAPSIZE_Y ) {
-                get_cache( p.z ).map_memory_seen_cache.reset( offset );
+            level_cache *ch = find_cache( p.z );
+            if( ch != nullptr && offset >= 0 && offset < MAPSIZE_X * MAPSIZE_Y ) {
+                ch->map_memory_seen_cache.reset( offset );
             }
         }
 
         void invalidate_map_cache( const int zlev ) {
-            if( inbounds_z( zlev ) ) {
-                level_cache &ch = get_cache( zlev );
-                ch.floor_cache_dirty = true;
-                ch.seen_cache_dirty = true;
-                ch.outside_cache_dirty = true;
+            level_cache *ch = inbounds_z( zlev ) ? find_cache( zlev ) : nullptr;
+            if( ch != nullptr ) {
+                ch->floor_cache_dirty = true;
+                ch->seen_cache_dirty = true;
+                ch->outside_cache_dirty = true;
                 set_transparency_cache_dirty( zlev );
             }
         }
 
+        // A level without a cache has nothing memorized yet
         bool check_seen_cache( const tripoint &p ) const {
-            std::bitset<MAPSIZE_X *MAPSIZE_Y> &memory_seen_cache =
-                get_cache( p.z ).map_memory_seen_cache;
-            return !memory_seen_cache[ static_cast<size_t>( p.x + p.y * MAPSIZE_Y ) ];
+            const level_cache *ch = find_cache( p.z );
+            return ch == nullptr ||
+                   !ch->map_memory_seen_cache[ static_cast<size_t>( p.x + p.y * MAPSIZE_Y ) ];
         }
         bool check_and_set_seen_cache( const tripoint &p ) const {
-            std::bitset<MAPSIZE_X *MAPSIZE_Y> &memory_seen_cache =
-                get_cache( p.z ).map_memory_seen_cache;
+            level_cache *ch = find_cache( p.z );
+            if( ch == nullptr ) {
+                return true;
+            }
+            std::bitset<MAPSIZE_X *MAPSIZE_Y> &memory_seen_cache = ch->map_memory_seen_cache;
             if( !memory_seen_cache[ static_cast<size_t>( p.x + p.y * MAPSIZE_Y ) ] ) {
                 memory_seen_cache.set( static_cast<size_t>( p.x + p.y * MAPSIZE_Y ) );
                 return true;
@@ -440,15 +442,20 @@ class map
                 return false;
             }
             if( from.z == to.z ) {
-                level_cache &cache = get_cache( from.z );
-                return cache.r_hor_cache->has_potential_los( from.xy(), to.xy(), cache ) &&
-                       cache.r_hor_cache->has_potential_los( to.xy(), from.xy(), cache ) ;
+                level_cache *cache = find_cache( from.z );
+                // Without a cache nothing rules the path out
+                return cache == nullptr || (
+                           cache->r_hor_cache->has_potential_los( from.xy(), to.xy(), *cache ) &&
+                           cache->r_hor_cache->has_potential_los( to.xy(), from.xy(), *cache ) );
             }
             tripoint upper, lower;
             std::tie( upper, lower ) = from.z > to.z ? std::make_pair( from, to ) : std::make_pair( to, from );
             // z-bounds depend on the invariant that both points are inbounds and their z are different
-            return get_cache( lower.z ).r_up_cache->has_potential_los(
-                       lower.xy(), upper.xy(), get_cache( lower.z ), get_cache( lower.z + 1 ) );
+            level_cache *lower_cache = find_cache( lower.z );
+            level_cache *upper_cache = find_cache( lower.z + 1 );
+            return lower_cache == nullptr || upper_cache == nullptr ||
+                   lower_cache->r_up_cache->has_potential_los( lower.xy(), upper.xy(), *lower_cache,
+                           *upper_cache );
         }
 
         int reachability_cache_value( const tripoint &p, bool vertical_cache,
@@ -634,6 +641,19 @@ class map
         * Returns whether `F` sees `T` with a view range of `range`.
         */
         bool sees( const tripoint &F, const tripoint &T, int range ) const;
+        /**
+         * Like @ref sees, but answers from a shadowcast field of view of `F` that is
+         * shared by every viewer standing on the same tile until the seen cache is
+         * invalidated. Falls back to @ref sees for checks between z-levels.
+         */
+        bool sees_from_fov( const tripoint &F, const tripoint &T, int range ) const;
+        const fov_bitmap_cache &get_creature_fov_cache() const {
+            return creature_fov_cache;
+        }
+        /** Cache of recent @ref sees results, exposed for its hit-rate counters and generation. */
+        const los_cache &get_skew_vision_cache() const {
+            return skew_vision_cache;
+        }
     private:
         /**
          * Don't expose the slope adjust outside map functions.
@@ -1750,7 +1770,6 @@ class map
          */
         void shift_traps( const tripoint &shift );
 
-        void copy_grid( const tripoint &to, const tripoint &from );
         void draw_map( mapgendata &dat );
 
         void draw_lab( mapgendata &dat );
@@ -1869,12 +1888,27 @@ class map
          * @return max_populated_zlev value
          */
         int calc_max_populated_zlev();
+        /** Calculate the lowest populated zlevel in the loaded submaps, the counterpart of
+         * @ref calc_max_populated_zlev.
+         * fills the map::min_populated_zlev and returns it
+         */
+        int calc_min_populated_zlev();
         /**
-         * Conditionally invalidates max_pupulated_zlev cache if the submap uniformity change occurs above current
-         *  max_pupulated_zlev value
+         * Conditionally invalidates max_pupulated_zlev and min_populated_zlev caches if the
+         * submap uniformity change occurs outside of the current populated range
          * @param zlev zlevel where uniformity change occurred
          */
-        void invalidate_max_populated_zlev( int zlev );
+        void invalidate_populated_zlevs( int zlev );
+        /**
+         * Picks the z-levels build_map_cache keeps caches for, see @ref cached_zlevs, and frees
+         * the caches of the levels outside of them. Levels that just got a cache have their
+         * vehicle and field tracking rebuilt from their submaps.
+         */
+        void update_cached_zlevs( int zlev );
+        /** True if zlev is outside of @ref cached_zlevs, so it only holds uniform submaps. */
+        bool outside_cached_zlevs( int zlev ) const {
+            return zlevels && ( zlev < cached_zlevs.first || zlev > cached_zlevs.second );
+        }
 
         /**
          * Internal versions of public functions to avoid checking same variables multiple times.
@@ -1959,8 +1993,13 @@ class map
          * The list of currently loaded submaps. The size of this should not be changed.
          * After calling @ref load or @ref generate, it should only contain non-null pointers.
          * Use @ref getsubmap or @ref setsubmap to access it.
+         *
+         * The grid is a ring buffer in x and y: @ref grid_origin is where the submap at
+         * grid coordinates (0, 0) is stored, and @ref get_nonant wraps around from there.
+         * @ref shift moves the origin instead of moving every submap pointer.
          */
         std::vector<submap *> grid;
+        point grid_origin;
         /**
          * This vector contains an entry for each trap type, it has therefore the same size
          * as the traplist vector. Each entry contains a list of all point on the map that
@@ -1978,8 +2017,17 @@ class map
         std::vector<tripoint> field_ter_locs;
         /**
          * Holds caches for visibility, light, transparency and vehicles
+         * Allocated for every z-level at construction, afterwards only update_cached_zlevs
+         * allocates or frees them, keeping exactly the levels in @ref cached_zlevs.
+         */
+        mutable std::array< std::unique_ptr<level_cache>, OVERMAP_LAYERS > caches;
+        /**
+         * Lowest and highest z-level whose caches build_map_cache keeps up to date: the
+         * viewer's level plus fov_3d_z_range either way, stretched over every level with
+         * non-uniform submaps, vehicles or fields. Above it there is only uniform sky, below it
+         * only uniform rock, so those levels need no caches.
          */
-        std::array< std::unique_ptr<level_cache>, OVERMAP_LAYERS > caches;
+        std::pair<int, int> cached_zlevs = { -OVERMAP_DEPTH, OVERMAP_HEIGHT };
 
         mutable std::array< std::unique_ptr<pathfinding_cache>, OVERMAP_LAYERS > pathfinding_caches;
         /**
@@ -1990,12 +2038,31 @@ class map
         /**
          * Cache of coordinate pairs recently checked for visibility.
          */
-        mutable lru_cache<point, char> skew_vision_cache;
+        mutable los_cache skew_vision_cache;
+        /**
+         * Field of view bitmaps of creatures, see @ref sees_from_fov.
+         */
+        mutable fov_bitmap_cache creature_fov_cache;
+        /**
+         * Luminance of the bulk light sources queued by @ref add_light_source. Shared by all
+         * z-levels: it only holds the level generate_lightmap is working on, light_source_z.
+         */
+        struct light_source_grid {
+            float luminance[MAPSIZE_X][MAPSIZE_Y];
+        };
+        std::unique_ptr<light_source_grid> light_source_buffer;
+        int light_source_z = INT_MIN;
 
-        // Note: no bounds check
+        // Only for z-levels in cached_zlevs, see find_cache for the others. Note: no bounds check
         level_cache &get_cache( int zlev ) const {
             return *caches[zlev + OVERMAP_DEPTH];
         }
+        // Shared stand-in for the caches of z-levels that have none allocated
+        static const level_cache &empty_cache();
+        // Returns nullptr if the cache has not been allocated. Note: no bounds check
+        level_cache *find_cache( int zlev ) const {
+            return caches[zlev + OVERMAP_DEPTH].get();
+        }
 
         pathfinding_cache &get_pathfinding_cache( int zlev ) const;
 
@@ -2004,10 +2071,19 @@ class map
         // caches the highest zlevel above which all zlevels are uniform
         // !value || value->first != map::abs_sub means cache is invalid
         cata::optional<std::pair<tripoint, int>> max_populated_zlev = cata::nullopt;
+        // caches the lowest zlevel below which all zlevels are uniform, same as above
+        cata::optional<std::pair<tripoint, int>> min_populated_zlev = cata::nullopt;
 
     public:
+        // Never allocates: a z-level without a cache gets an empty one, as if nothing was seen
+        // or lit there. Note: no bounds check
         const level_cache &get_cache_ref( int zlev ) const {
-            return *caches[zlev + OVERMAP_DEPTH];
+            const level_cache *ch = find_cache( zlev );
+            return ch != nullptr ? *ch : empty_cache();
+        }
+        // Lowest and highest z-level with up to date caches, see build_map_cache
+        std::pair<int, int> get_cached_zlevs() const {
+            return cached_zlevs;
         }
 
         const pathfinding_cache &get_pathfinding_cache_ref( int zlev ) const;
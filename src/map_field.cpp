@@ -145,7 +145,12 @@ void map::process_fields()
     const int minz = zlevels ? -OVERMAP_DEPTH : abs_sub.z;
     const int maxz = zlevels ? OVERMAP_HEIGHT : abs_sub.z;
     for( int z = minz; z <= maxz; z++ ) {
-        auto &field_cache = get_cache( z ).field_cache;
+        level_cache *ch = find_cache( z );
+        if( ch == nullptr ) {
+            // build_map_cache gives the level a cache, and picks up its fields, once it has any
+            continue;
+        }
+        auto &field_cache = ch->field_cache;
         for( int x = 0; x < my_MAPSIZE; x++ ) {
             for( int y = 0; y < my_MAPSIZE; y++ ) {
                 if( field_cache[ x + y * MAPSIZE ] ) {
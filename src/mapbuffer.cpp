@@ -1,5 +1,7 @@
 #include "mapbuffer.h"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
 #include <exception>
 #include <functional>
@@ -55,6 +57,9 @@ void mapbuffer::reset()
         delete elem.second;
     }
     submaps.clear();
+    quads.clear();
+    total_bytes = 0;
+    num_evicted = 0;
 }
 
 bool mapbuffer::add_submap( const tripoint &p, submap *sm )
@@ -64,6 +69,7 @@ bool mapbuffer::add_submap( const tripoint &p, submap *sm )
     }
 
     submaps[p] = sm;
+    touch_quad( p );
 
     return true;
 }
@@ -86,6 +92,10 @@ void mapbuffer::remove_submap( tripoint addr )
     }
     delete m_target->second;
     submaps.erase( m_target );
+    const auto quad = quads.find( sm_to_omt_copy( addr ) );
+    if( quad != quads.end() ) {
+        quad->second.size_dirty = true;
+    }
 }
 
 submap *mapbuffer::lookup_submap( const tripoint &p )
@@ -102,19 +112,123 @@ submap *mapbuffer::lookup_submap( const tripoint &p )
         return nullptr;
     }
 
+    touch_quad( p );
     return iter->second;
 }
 
-void mapbuffer::save( bool delete_after_save )
+submap *mapbuffer::find_resident_submap( const tripoint &p ) const
 {
-    assure_dir_exist( PATH_INFO::world_base_save_path() + "/maps" );
+    const auto iter = submaps.find( p );
+    return iter == submaps.end() ? nullptr : iter->second;
+}
 
-    int num_saved_submaps = 0;
-    int num_total_submaps = submaps.size();
+void mapbuffer::touch_quad( const tripoint &p )
+{
+    quad_residency &quad = quads[sm_to_omt_copy( p )];
+    quad.last_used = ++quad_use_counter;
+    quad.size_dirty = true;
+}
 
+void mapbuffer::update_quad_sizes()
+{
+    static const std::array<point, 4> offsets = {{
+            point_zero, point_south, point_east, point_south_east
+        }
+    };
+    for( auto iter = quads.begin(); iter != quads.end(); ) {
+        quad_residency &quad = iter->second;
+        if( !quad.size_dirty ) {
+            ++iter;
+            continue;
+        }
+        total_bytes -= quad.bytes;
+        quad.bytes = 0;
+        bool any_loaded = false;
+        const tripoint sm_addr = omt_to_sm_copy( iter->first );
+        for( const point &offset : offsets ) {
+            const auto sm = submaps.find( sm_addr + offset );
+            if( sm != submaps.end() && sm->second != nullptr ) {
+                quad.bytes += sm->second->estimated_memory_usage();
+                any_loaded = true;
+            }
+        }
+        if( !any_loaded ) {
+            iter = quads.erase( iter );
+            continue;
+        }
+        total_bytes += quad.bytes;
+        quad.size_dirty = false;
+        ++iter;
+    }
+}
+
+size_t mapbuffer::resident_bytes()
+{
+    update_quad_sizes();
+    return total_bytes;
+}
+
+bool mapbuffer::outside_reality_bubble( const tripoint &om_addr )
+{
     map &here = get_map();
     const tripoint map_origin = sm_to_omt_copy( here.get_abs_sub() );
     const bool map_has_zlevels = g != nullptr && here.has_zlevels();
+    const bool zlev_del = !map_has_zlevels && om_addr.z != here.get_abs_sub().z;
+    return zlev_del ||
+           om_addr.x < map_origin.x || om_addr.y < map_origin.y ||
+           om_addr.x > map_origin.x + HALF_MAPSIZE ||
+           om_addr.y > map_origin.y + HALF_MAPSIZE;
+}
+
+size_t mapbuffer::evict_to_budget( const size_t budget )
+{
+    for( auto &quad : quads ) {
+        // Submaps in the reality bubble change all the time, measure them again.
+        if( !outside_reality_bubble( quad.first ) ) {
+            quad.second.size_dirty = true;
+        }
+    }
+    update_quad_sizes();
+    if( total_bytes <= budget ) {
+        return 0;
+    }
+
+    std::vector<std::pair<uint64_t, tripoint>> candidates;
+    for( const auto &quad : quads ) {
+        if( outside_reality_bubble( quad.first ) ) {
+            candidates.emplace_back( quad.second.last_used, quad.first );
+        }
+    }
+    std::sort( candidates.begin(), candidates.end() );
+
+    assure_dir_exist( PATH_INFO::world_base_save_path() + "/maps" );
+    std::list<tripoint> submaps_to_delete;
+    size_t remaining = total_bytes;
+    for( const std::pair<uint64_t, tripoint> &candidate : candidates ) {
+        if( remaining <= budget ) {
+            break;
+        }
+        const tripoint &om_addr = candidate.second;
+        const std::string dirname = find_dirname( om_addr );
+        save_quad( dirname, find_quad_path( dirname, om_addr ), om_addr, submaps_to_delete, true );
+        remaining -= quads[om_addr].bytes;
+    }
+    for( const tripoint &elem : submaps_to_delete ) {
+        remove_submap( elem );
+    }
+    update_quad_sizes();
+    num_evicted += submaps_to_delete.size();
+    dbg( D_INFO ) << "mapbuffer::evict_to_budget evicted " << submaps_to_delete.size()
+                  << " submaps, " << total_bytes << " bytes remain";
+    return submaps_to_delete.size();
+}
+
+void mapbuffer::save( bool delete_after_save )
+{
+    assure_dir_exist( PATH_INFO::world_base_save_path() + "/maps" );
+
+    int num_saved_submaps = 0;
+    int num_total_submaps = submaps.size();
 
     static_popup popup;
 
@@ -153,12 +267,8 @@ void mapbuffer::save( bool delete_after_save )
 
         // delete_on_save deletes everything, otherwise delete submaps
         // outside the current map.
-        const bool zlev_del = !map_has_zlevels && om_addr.z != get_map().get_abs_sub().z;
         save_quad( dirname, quad_path, om_addr, submaps_to_delete,
-                   delete_after_save || zlev_del ||
-                   om_addr.x < map_origin.x || om_addr.y < map_origin.y ||
-                   om_addr.x > map_origin.x + HALF_MAPSIZE ||
-                   om_addr.y > map_origin.y + HALF_MAPSIZE );
+                   delete_after_save || outside_reality_bubble( om_addr ) );
         num_saved_submaps += 4;
     }
     for( auto &elem : submaps_to_delete ) {
@@ -183,8 +293,8 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         submap_addr.x += offsets_offset.x;
         submap_addr.y += offsets_offset.y;
         submap_addrs.push_back( submap_addr );
-        submap *sm = submaps[submap_addr];
-        if( sm != nullptr && !sm->is_uniform ) {
+        const auto it = submaps.find( submap_addr );
+        if( it != submaps.end() && it->second != nullptr && !it->second->is_uniform ) {
             all_uniform = false;
         }
     }
@@ -193,7 +303,8 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         // Nothing to save - this quad will be regenerated faster than it would be re-read
         if( delete_after_save ) {
             for( auto &submap_addr : submap_addrs ) {
-                if( submaps.count( submap_addr ) > 0 && submaps[submap_addr] != nullptr ) {
+                const auto it = submaps.find( submap_addr );
+                if( it != submaps.end() && it->second != nullptr ) {
                     submaps_to_delete.push_back( submap_addr );
                 }
             }
@@ -208,15 +319,11 @@ void mapbuffer::save_quad( const std::string &dirname, const std::string &filena
         JsonOut jsout( fout );
         jsout.start_array();
         for( auto &submap_addr : submap_addrs ) {
-            if( submaps.count( submap_addr ) == 0 ) {
-                continue;
-            }
-
-            submap *sm = submaps[submap_addr];
-
-            if( sm == nullptr ) {
+            const auto it = submaps.find( submap_addr );
+            if( it == submaps.end() || it->second == nullptr ) {
                 continue;
             }
+            submap *sm = it->second;
 
             jsout.start_object();
 
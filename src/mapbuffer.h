@@ -2,6 +2,8 @@
 #ifndef CATA_SRC_MAPBUFFER_H
 #define CATA_SRC_MAPBUFFER_H
 
+#include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <list>
 #include <map>
@@ -54,6 +56,31 @@ class mapbuffer
          */
         submap *lookup_submap( const tripoint &p );
 
+        /**
+         * Like @ref lookup_submap, but never loads the submap from disk and doesn't count as
+         * a use of it. Returns NULL if the submap is not held in memory.
+         */
+        submap *find_resident_submap( const tripoint &p ) const;
+
+        /** Number of submaps currently held in memory. */
+        size_t resident_submaps() const {
+            return submaps.size();
+        }
+        /** Approximate memory used by the buffered submaps, in bytes. */
+        size_t resident_bytes();
+        /** Number of submaps evicted by @ref evict_to_budget since the buffer was reset. */
+        size_t evicted_submaps() const {
+            return num_evicted;
+        }
+
+        /**
+         * Write back and delete the least recently used quads outside the reality bubble
+         * until the buffered submaps use at most `budget` bytes (approximately).
+         * Only call this while no map other than the main one holds submap pointers.
+         * @return Number of submaps evicted.
+         */
+        size_t evict_to_budget( size_t budget );
+
     private:
         using submap_map_t = std::map<tripoint, submap *>;
 
@@ -74,7 +101,25 @@ class mapbuffer
         void save_quad( const std::string &dirname, const std::string &filename,
                         const tripoint &om_addr, std::list<tripoint> &submaps_to_delete,
                         bool delete_after_save );
+        /** Whether the quad at `om_addr` may be deleted from memory while the game runs. */
+        static bool outside_reality_bubble( const tripoint &om_addr );
+        /** Records a use of the quad containing the submap at `p`. */
+        void touch_quad( const tripoint &p );
+        /** Recalculates the sizes of quads that changed since they were last measured. */
+        void update_quad_sizes();
+
         submap_map_t submaps;
+
+        /** Recency and approximate size of each quad (2x2 submaps), keyed by overmap terrain position. */
+        struct quad_residency {
+            uint64_t last_used = 0;
+            size_t bytes = 0;
+            bool size_dirty = true;
+        };
+        std::map<tripoint, quad_residency> quads;
+        uint64_t quad_use_counter = 0;
+        size_t total_bytes = 0;
+        size_t num_evicted = 0;
 };
 
 extern mapbuffer MAPBUFFER;
@@ -113,6 +113,9 @@ void map::generate( const tripoint &p, const time_point &when )
     dbg( D_INFO ) << "map::generate( g[" << g.get() << "], p[" << p << "], "
                   "when[" << to_string( when ) << "] )";
 
+    // Keep mapgen's rolls apart from the rest of the game's
+    const rng_stream_scope mapgen_rolls( rng_stream::mapgen );
+
     set_abs_sub( p );
 
     // First we have to create new submaps and initialize them to 0 all over
@@ -5431,11 +5434,12 @@ vehicle *map::add_vehicle( const vproto_id &type, const tripoint &p, const units
         }
         place_on_submap->vehicles.push_back( std::move( placed_vehicle_up ) );
         place_on_submap->is_uniform = false;
-        invalidate_max_populated_zlev( p.z );
+        invalidate_populated_zlevs( p.z );
 
-        auto &ch = get_cache( placed_vehicle->sm_pos.z );
-        ch.vehicle_list.insert( placed_vehicle );
-        add_vehicle_to_cache( placed_vehicle );
+        if( level_cache *ch = find_cache( placed_vehicle->sm_pos.z ) ) {
+            ch->vehicle_list.insert( placed_vehicle );
+            add_vehicle_to_cache( placed_vehicle );
+        }
 
         //debugmsg ("grid[%d]->vehicles.size=%d veh.parts.size=%d", nonant, grid[nonant]->vehicles.size(),veh.parts.size());
     }
@@ -0,0 +1,137 @@
+#include "message_log.h"
+
+#include "output.h"
+
+message_texts::id message_texts::intern( std::string &&text )
+{
+    const auto found = ids.find( text );
+    if( found != ids.end() ) {
+        ++entries[found->second].refs;
+        return found->second;
+    }
+    id new_id;
+    if( free_ids.empty() ) {
+        new_id = entries.size();
+        entries.emplace_back();
+    } else {
+        new_id = free_ids.back();
+        free_ids.pop_back();
+    }
+    entry &e = entries[new_id];
+    e.text = &ids.emplace( std::move( text ), new_id ).first->first;
+    e.refs = 1;
+    return new_id;
+}
+
+void message_texts::retain( const id i )
+{
+    ++entries[i].refs;
+}
+
+void message_texts::release( const id i )
+{
+    entry &e = entries[i];
+    if( --e.refs == 0 ) {
+        ids.erase( *e.text );
+        e = entry();
+        free_ids.push_back( i );
+    }
+}
+
+const std::string &message_texts::search_text( const id i )
+{
+    entry &e = entries[i];
+    if( !e.has_search_text ) {
+        e.search_text = remove_color_tags( *e.text );
+        e.has_search_text = true;
+    }
+    return e.search_text;
+}
+
+const std::vector<std::string> &message_texts::folded( const id i, const int count,
+        const int width, const bool strip_tags, const std::function<std::string()> &shown )
+{
+    std::vector<folded_lines> &cache = entries[i].folded;
+    for( const folded_lines &f : cache ) {
+        if( f.width == width && f.count == count && f.strip_tags == strip_tags ) {
+            return f.lines;
+        }
+    }
+    // The sidebar and the log window each want their own width, and a
+    // repeated message goes through a few counts, so keep a handful.
+    if( cache.size() >= max_folded_per_text ) {
+        cache.erase( cache.begin() );
+    }
+    const std::string text = strip_tags ? remove_color_tags( shown() ) : shown();
+    cache.push_back( folded_lines{ width, count, strip_tags, foldstring( text, width ) } );
+    return cache.back().lines;
+}
+
+void message_cooldowns::refresh( const message_text &text, const time_point &turn,
+                                 const int cooldown, const bool bypass )
+{
+    // housekeeping: remove any cooldown message with an expired cooldown time from the cooldown queue.
+    // Cooldowns only run out as turns pass, so once per turn is enough.
+    if( turn != swept ) {
+        swept = turn;
+        for( auto it = templates.begin(); it != templates.end(); ) {
+            // number of turns elapsed since the cooldown started.
+            const int turns = to_turns<int>( turn - it->second.started );
+            if( turns >= cooldown ) {
+                // time elapsed! remove it.
+                it = templates.erase( it );
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // do not hide messages which bypasses cooldown.
+    if( bypass ) {
+        return;
+    }
+
+    // Is the message string already in the cooldown queue?
+    // If it's not we must put it in the cooldown queue now, otherwise just increment the number of times we have seen it.
+    const auto it = templates.find( text.id() );
+    if( it == templates.end() ) {
+        templates.emplace( text.id(), cooldown_template{ text, turn, 1 } );
+    } else {
+        it->second.seen++;
+    }
+}
+
+bool message_cooldowns::hides( const message_text &text, const time_point &turn,
+                               const int cooldown ) const
+{
+    // We look for **exactly the same** message string in the cooldown templates
+    // If there is one, this means the same message was already displayed.
+    const auto it = templates.find( text.id() );
+    if( it == templates.end() ) {
+        // nothing found, not in cooldown.
+        return false;
+    }
+    const cooldown_template &cooldown_tmpl = it->second;
+
+    // check how much times this message has been seen during its cooldown.
+    // If it's only one time, then no need to hide it.
+    if( cooldown_tmpl.seen == 1 ) {
+        return false;
+    }
+
+    // check if it's the message that started the cooldown timer.
+    if( turn == cooldown_tmpl.started ) {
+        return false;
+    }
+
+    // If the current message is in the cooldown range then hide it.
+    return to_turn<int>( turn ) <= to_turn<int>( cooldown_tmpl.started ) + cooldown;
+}
+
+void message_cooldowns::restart( const message_text &text, const time_point &turn )
+{
+    const auto it = templates.find( text.id() );
+    if( it != templates.end() ) {
+        it->second.started = turn;
+    }
+}
@@ -0,0 +1,235 @@
+#pragma once
+#ifndef CATA_SRC_MESSAGE_LOG_H
+#define CATA_SRC_MESSAGE_LOG_H
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "calendar.h"
+
+/**
+ * Message texts, each stored once however often it shows up in the log or the
+ * cooldown templates. Messages refer to their text by id, so comparing two of
+ * them is an integer compare, and the folded lines the log windows print are
+ * cached along with the text. A text is dropped once no message refers to it,
+ * and its id (with an empty cache) goes to the next new text.
+ */
+class message_texts
+{
+    public:
+        using id = size_t;
+
+        id intern( std::string &&text );
+        void retain( id i );
+        void release( id i );
+
+        const std::string &text( const id i ) const {
+            return *entries[i].text;
+        }
+
+        /** The text without color tags, as the log filter matches it. */
+        const std::string &search_text( id i );
+
+        /**
+         * The text as shown with the given count, folded to `width`. `shown` makes
+         * that string, and is only called when the lines are not cached yet.
+         */
+        const std::vector<std::string> &folded( id i, int count, int width, bool strip_tags,
+                                                const std::function<std::string()> &shown );
+
+        /** Number of distinct texts currently kept. */
+        size_t size() const {
+            return ids.size();
+        }
+
+    private:
+        static constexpr size_t max_folded_per_text = 4;
+
+        struct folded_lines {
+            int width;
+            int count;
+            bool strip_tags;
+            std::vector<std::string> lines;
+        };
+
+        struct entry {
+            // Points at the key in ids, which stays put until the text is dropped.
+            const std::string *text = nullptr;
+            unsigned refs = 0;
+            bool has_search_text = false;
+            std::string search_text;
+            std::vector<folded_lines> folded;
+        };
+
+        std::vector<entry> entries;
+        std::vector<id> free_ids;
+        std::unordered_map<std::string, id> ids;
+};
+
+/** A counted reference to a text interned in a @ref message_texts pool. */
+class message_text
+{
+    public:
+        message_text() = default;
+        message_text( message_texts &pool, std::string &&text ) :
+            pool_( &pool ), id_( pool.intern( std::move( text ) ) ) {
+        }
+        message_text( const message_text &other ) : pool_( other.pool_ ), id_( other.id_ ) {
+            if( id_ != none ) {
+                pool_->retain( id_ );
+            }
+        }
+        message_text( message_text &&other ) noexcept : pool_( other.pool_ ), id_( other.id_ ) {
+            other.id_ = none;
+        }
+        message_text &operator=( const message_text &other ) {
+            message_text copy( other );
+            swap( copy );
+            return *this;
+        }
+        message_text &operator=( message_text &&other ) noexcept {
+            swap( other );
+            return *this;
+        }
+        ~message_text() {
+            if( id_ != none ) {
+                pool_->release( id_ );
+            }
+        }
+
+        message_texts::id id() const {
+            return id_;
+        }
+
+        const std::string &str() const {
+            static const std::string empty;
+            return id_ == none ? empty : pool_->text( id_ );
+        }
+
+        bool operator==( const message_text &rhs ) const {
+            return id_ == rhs.id_;
+        }
+        bool operator!=( const message_text &rhs ) const {
+            return id_ != rhs.id_;
+        }
+
+    private:
+        void swap( message_text &other ) noexcept {
+            std::swap( pool_, other.pool_ );
+            std::swap( id_, other.id_ );
+        }
+
+        static constexpr message_texts::id none = std::numeric_limits<message_texts::id>::max();
+        message_texts *pool_ = nullptr;
+        message_texts::id id_ = none;
+};
+
+/**
+ * The newest messages, oldest first, in a buffer that wraps around once it holds
+ * as many as the message limit allows, so adding a message never shifts or
+ * reallocates the history.
+ */
+template<typename Message>
+class message_ring
+{
+    public:
+        size_t size() const {
+            return slots.size();
+        }
+
+        bool empty() const {
+            return slots.empty();
+        }
+
+        void clear() {
+            slots.clear();
+            capacity = 0;
+            start = 0;
+        }
+
+        const Message &operator[]( const size_t i ) const {
+            return slots[( start + i ) % slots.size()];
+        }
+
+        Message &back() {
+            return slots[( start + slots.size() - 1 ) % slots.size()];
+        }
+
+        const Message &back() const {
+            return slots[( start + slots.size() - 1 ) % slots.size()];
+        }
+
+        /** Adds a message, dropping the oldest ones beyond `new_capacity` (at least one). */
+        void push_back( Message &&m, const size_t new_capacity ) {
+            if( new_capacity != capacity ) {
+                set_capacity( new_capacity );
+            }
+            if( slots.size() < capacity ) {
+                slots.emplace_back( std::move( m ) );
+            } else {
+                slots[start] = std::move( m );
+                start = ( start + 1 ) % slots.size();
+            }
+        }
+
+    private:
+        void set_capacity( const size_t new_capacity ) {
+            // Keep the newest messages, in order, when the limit changes.
+            std::vector<Message> kept;
+            kept.reserve( new_capacity );
+            const size_t count = slots.size();
+            for( size_t i = count > new_capacity ? count - new_capacity : 0; i < count; ++i ) {
+                kept.emplace_back( std::move( slots[( start + i ) % count] ) );
+            }
+            slots = std::move( kept );
+            capacity = new_capacity;
+            start = 0;
+        }
+
+        // Holds up to capacity messages, the oldest at start once it is full.
+        std::vector<Message> slots;
+        size_t capacity = 0;
+        size_t start = 0;
+};
+
+/**
+ * Message texts that were recently shown, by their text. A message repeating one of
+ * them within `cooldown` turns is hidden from the sidebar.
+ */
+class message_cooldowns
+{
+    public:
+        /**
+         * Drops the elapsed cooldowns, and starts one for `text` or counts another sighting
+         * of it, unless `bypass` is set.
+         */
+        void refresh( const message_text &text, const time_point &turn, int cooldown, bool bypass );
+
+        /** Whether a message with `text` shown on `turn` is hidden by its cooldown. */
+        bool hides( const message_text &text, const time_point &turn, int cooldown ) const;
+
+        /** Restarts the cooldown of `text`, if it has one, when a message repeats the last one. */
+        void restart( const message_text &text, const time_point &turn );
+
+        size_t size() const {
+            return templates.size();
+        }
+
+    private:
+        struct cooldown_template {
+            message_text text;
+            time_point started = calendar::turn_zero;
+            // number of times this message has been seen while it was in cooldown.
+            unsigned seen = 1;
+        };
+
+        std::unordered_map<message_texts::id, cooldown_template> templates;
+        time_point swept = calendar::before_time_starts;
+};
+
+#endif // CATA_SRC_MESSAGE_LOG_H
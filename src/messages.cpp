@@ -10,6 +10,7 @@
 #include "game.h"
 #include "input.h"
 #include "json.h"
+#include "message_log.h"
 #include "output.h"
 #include "panels.h"
 #include "point.h"
@@ -23,31 +24,32 @@
 #include <SDL_keyboard.h>
 #endif
 #include <algorithm>
-#include <deque>
 #include <functional>
 #include <iterator>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "options.h"
 
 namespace
 {
 
+// Declared ahead of every message so it outlives them.
+message_texts message_text_pool;
+
 struct game_message : public JsonDeserializer, public JsonSerializer {
-    std::string       message;
+    message_text      text;
     time_point timestamp_in_turns  = calendar::turn_zero;
     int               timestamp_in_user_actions = 0;
     int               count = 1;
-    // number of times this message has been seen while it was in cooldown.
-    unsigned cooldown_seen = 1;
     // hide the message, because at some point it was in cooldown period.
     bool cooldown_hidden = false;
     game_message_type type  = m_neutral;
 
     game_message() = default;
     game_message( std::string &&msg, game_message_type const t ) :
-        message( std::move( msg ) ),
+        text( message_text_pool, std::move( msg ) ),
         timestamp_in_turns( calendar::turn ),
         timestamp_in_user_actions( g->get_user_action_counter() ),
         type( t ) {
@@ -59,10 +61,25 @@ struct game_message : public JsonDeserializer, public JsonSerializer {
 
     std::string get_with_count() const {
         if( count <= 1 ) {
-            return message;
+            return text.str();
         }
         //~ Message %s on the message log was repeated %d times, e.g. "You hear a whack! x 12"
-        return string_format( _( "%s x %d" ), message, count );
+        return string_format( _( "%s x %d" ), text.str(), count );
+    }
+
+    /** Whether the message, as shown with its count, contains `filter_text` ignoring case. */
+    bool matches( const std::string &filter_text ) const {
+        if( count <= 1 ) {
+            return ci_find_substr( message_text_pool.search_text( text.id() ), filter_text ) >= 0;
+        }
+        return ci_find_substr( remove_color_tags( get_with_count() ), filter_text ) >= 0;
+    }
+
+    /** The message with its count folded to `width`, optionally without color tags. */
+    const std::vector<std::string> &folded( const int width, const bool strip_tags ) const {
+        return message_text_pool.folded( text.id(), count, width, strip_tags, [this]() {
+            return get_with_count();
+        } );
     }
 
     /** Get whether or not a message should not be displayed (hidden) in the side bar because it's in a cooldown period.
@@ -97,7 +114,7 @@ struct game_message : public JsonDeserializer, public JsonSerializer {
     void deserialize( JsonIn &jsin ) override {
         JsonObject obj = jsin.get_object();
         obj.read( "turn", timestamp_in_turns );
-        message = obj.get_string( "message" );
+        text = message_text( message_text_pool, obj.get_string( "message" ) );
         count = obj.get_int( "count" );
         type = static_cast<game_message_type>( obj.get_int( "type" ) );
     }
@@ -105,7 +122,7 @@ struct game_message : public JsonDeserializer, public JsonSerializer {
     void serialize( JsonOut &jsout ) const override {
         jsout.start_object();
         jsout.member( "turn", timestamp_in_turns );
-        jsout.member( "message", message );
+        jsout.member( "message", text.str() );
         jsout.member( "count", count );
         jsout.member( "type", static_cast<int>( type ) );
         jsout.end_object();
@@ -115,8 +132,8 @@ struct game_message : public JsonDeserializer, public JsonSerializer {
 class messages_impl
 {
     public:
-        std::deque<game_message> messages;   // Messages to be printed
-        std::vector<game_message> cooldown_templates; // Message cooldown
+        message_ring<game_message> messages;   // Messages to be printed
+        message_cooldowns cooldowns;
         time_point curmes = calendar::turn_zero; // The last-seen message.
         bool active = true;
 
@@ -139,18 +156,12 @@ class messages_impl
                 return false;
             }
 
-            if( m.type != last_msg.type || m.message != last_msg.message ) {
+            if( m.type != last_msg.type || m.text != last_msg.text ) {
                 return false;
             }
 
             // update the cooldown message timer due to coalescing
-            const auto cooldown_it = std::find_if( cooldown_templates.begin(), cooldown_templates.end(),
-            [&m]( game_message & am ) -> bool {
-                return m.message == am.message;
-            } );
-            if( cooldown_it != cooldown_templates.end() ) {
-                cooldown_it->timestamp_in_turns = calendar::turn;
-            }
+            cooldowns.restart( m.text, calendar::turn );
 
             // coalesce messages
             last_msg.count++;
@@ -188,12 +199,7 @@ class messages_impl
                 return;
             }
 
-            unsigned int message_limit = get_option<int>( "MESSAGE_LIMIT" );
-            while( messages.size() > message_limit ) {
-                messages.pop_front();
-            }
-
-            messages.emplace_back( m );
+            messages.push_back( std::move( m ), get_option<int>( "MESSAGE_LIMIT" ) );
         }
 
         /** Check if the current message needs to be prevented (hidden) or not from being displayed in the side bar.
@@ -206,38 +212,8 @@ class messages_impl
                 return;
             }
 
-            // We look for **exactly the same** message string in the cooldown templates
-            // If there is one, this means the same message was already displayed.
-            const auto cooldown_it = std::find_if( cooldown_templates.begin(), cooldown_templates.end(),
-            [&message]( game_message & m_cooldown ) -> bool {
-                return m_cooldown.message == message.message;
-            } );
-            if( cooldown_it == cooldown_templates.end() ) {
-                // nothing found, not in cooldown.
-                return;
-            }
-
-            // note: from this point the current message (`message`) has the same string than one of the active cooldown template messages (`cooldown_it`).
-
-            // check how much times this message has been seen during its cooldown.
-            // If it's only one time, then no need to hide it.
-            if( cooldown_it->cooldown_seen == 1 ) {
-                return;
-            }
-
-            // check if it's the message that started the cooldown timer.
-            if( message.turn() == cooldown_it->turn() ) {
-                return;
-            }
-
-            // current message turn.
-            const int cm_turn = to_turn<int>( message.turn() );
-            // maximum range of the cooldown timer.
-            const int max_cooldown_range = to_turn<int>( cooldown_it->turn() ) + message_cooldown;
-            // If the current message is in the cooldown range then hide it.
-            if( cm_turn <= max_cooldown_range ) {
-                message.cooldown_hidden = true;
-            }
+            message.cooldown_hidden = cooldowns.hides( message.text, message.turn(),
+                                      message_cooldown );
         }
 
         std::vector<std::pair<std::string, std::string>> recent_messages( size_t count ) const {
@@ -246,13 +222,11 @@ class messages_impl
             std::vector<std::pair<std::string, std::string>> result;
             result.reserve( count );
 
-            const int offset = static_cast<std::ptrdiff_t>( messages.size() - count );
-
-            std::transform( begin( messages ) + offset, end( messages ), back_inserter( result ),
-            []( const game_message & msg ) {
-                return std::make_pair( to_string_time_of_day( msg.timestamp_in_turns ),
-                                       msg.get_with_count() );
-            } );
+            for( size_t i = messages.size() - count; i < messages.size(); ++i ) {
+                const game_message &msg = messages[i];
+                result.emplace_back( to_string_time_of_day( msg.timestamp_in_turns ),
+                                     msg.get_with_count() );
+            }
 
             return result;
         }
@@ -267,37 +241,8 @@ class messages_impl
                 return;
             }
 
-            // housekeeping: remove any cooldown message with an expired cooldown time from the cooldown queue.
-            const time_point now = calendar::turn;
-            for( auto it = cooldown_templates.begin(); it != cooldown_templates.end(); ) {
-                // number of turns elapsed since the cooldown started.
-                const int turns = to_turns<int>( now - it->turn() );
-                if( turns >= message_cooldown ) {
-                    // time elapsed! remove it.
-                    it = cooldown_templates.erase( it );
-                } else {
-                    ++it;
-                }
-            }
-
-            // do not hide messages which bypasses cooldown.
-            if( ( flags & gmf_bypass_cooldown ) != 0 ) {
-                return;
-            }
-
-            // Is the message string already in the cooldown queue?
-            // If it's not we must put it in the cooldown queue now, otherwise just increment the number of times we have seen it.
-            const auto cooldown_message_it = std::find_if( cooldown_templates.begin(),
-            cooldown_templates.end(), [&message]( game_message & cooldown_message ) -> bool {
-                return cooldown_message.message == message.message;
-            } );
-            if( cooldown_message_it == cooldown_templates.end() ) {
-                // push current message to cooldown message templates.
-                cooldown_templates.emplace_back( message );
-            } else {
-                // increment the number of time we have seen this message.
-                cooldown_message_it->cooldown_seen++;
-            }
+            cooldowns.refresh( message.text, message.turn(), message_cooldown,
+                               ( flags & gmf_bypass_cooldown ) != 0 );
         }
 };
 
@@ -321,7 +266,12 @@ void Messages::serialize( JsonOut &json )
 {
     json.member( "player_messages" );
     json.start_object();
-    json.member( "messages", player_messages.messages );
+    json.member( "messages" );
+    json.start_array();
+    for( size_t i = 0; i < player_messages.messages.size(); ++i ) {
+        json.write( player_messages.messages[i] );
+    }
+    json.end_array();
     json.member( "curmes", player_messages.curmes );
     json.end_object();
 }
@@ -333,7 +283,13 @@ void Messages::deserialize( const JsonObject &json )
     }
 
     JsonObject obj = json.get_object( "player_messages" );
-    obj.read( "messages", player_messages.messages );
+    std::vector<game_message> messages;
+    obj.read( "messages", messages );
+    player_messages.messages.clear();
+    const size_t message_limit = get_option<int>( "MESSAGE_LIMIT" );
+    for( game_message &m : messages ) {
+        player_messages.messages.push_back( std::move( m ), message_limit );
+    }
     obj.read( "curmes", player_messages.curmes );
 }
 
@@ -532,8 +488,7 @@ void Messages::dialog::init( ui_adaptor &ui )
     for( size_t ind = 0; ind < msg_count; ++ind ) {
         const size_t msg_ind = log_from_top ? ind : msg_count - 1 - ind;
         const game_message &msg = player_messages.history( msg_ind );
-        const auto &folded = foldstring( msg.get_with_count(), msg_width );
-        for( const auto &it : folded ) {
+        for( const std::string &it : msg.folded( msg_width, false ) ) {
             folded_filtered.emplace_back( folded_all.size() );
             folded_all.emplace_back( msg_ind, it );
         }
@@ -669,8 +624,7 @@ void Messages::dialog::do_filter( const std::string &filter_str )
     for( size_t folded_ind = 0; folded_ind < folded_all.size(); ) {
         const size_t msg_ind = folded_all[folded_ind].first;
         const game_message &msg = player_messages.history( msg_ind );
-        const bool match = ( !has_type_filter || filter_type == msg.type ) &&
-                           ci_find_substr( remove_color_tags( msg.get_with_count() ), filter_text ) >= 0;
+        const bool match = ( !has_type_filter || filter_type == msg.type ) && msg.matches( filter_text );
 
         // Always advance the index, but only add to filtered list if the original message matches
         for( ; folded_ind < folded_all.size() && folded_all[folded_ind].first == msg_ind; ++folded_ind ) {
@@ -822,12 +776,8 @@ void Messages::display_messages( const catacurses::window &ipk_target, const int
             }
 
             const nc_color col = m.get_color( player_messages.curmes );
-            std::string message_text = m.get_with_count();
-            if( !m.is_recent( player_messages.curmes ) ) {
-                message_text = remove_color_tags( message_text );
-            }
-
-            for( const std::string &folded : foldstring( message_text, maxlength ) ) {
+            const bool strip_tags = !m.is_recent( player_messages.curmes );
+            for( const std::string &folded : m.folded( maxlength, strip_tags ) ) {
                 if( line > bottom ) {
                     break;
                 }
@@ -855,12 +805,8 @@ void Messages::display_messages( const catacurses::window &ipk_target, const int
             }
 
             const nc_color col = m.get_color( player_messages.curmes );
-            std::string message_text = m.get_with_count();
-            if( !m.is_recent( player_messages.curmes ) ) {
-                message_text = remove_color_tags( message_text );
-            }
-
-            const auto folded_strings = foldstring( message_text, maxlength );
+            const bool strip_tags = !m.is_recent( player_messages.curmes );
+            const std::vector<std::string> &folded_strings = m.folded( maxlength, strip_tags );
             const auto folded_rend = folded_strings.rend();
             for( auto string_iter = folded_strings.rbegin();
                  string_iter != folded_rend && line >= top; ++string_iter, line-- ) {
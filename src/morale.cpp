@@ -140,6 +140,16 @@ bool player_morale::morale_point::is_permanent() const
     return ( duration == 0_turns );
 }
 
+time_duration player_morale::morale_point::time_to_change() const
+{
+    if( is_permanent() ) {
+        return calendar::INDEFINITELY_LONG_DURATION;
+    }
+    // Once past decay_start the net bonus keeps shrinking every turn
+    const time_duration until_decay = age > decay_start ? 1_turns : decay_start - age + 1_turns;
+    return std::min( until_decay, duration - age );
+}
+
 bool player_morale::morale_point::matches( const morale_type &_type, const itype *_item_type ) const
 {
     return ( _type == type ) && ( _item_type == nullptr || _item_type == item_type );
@@ -285,6 +295,9 @@ void player_morale::add( const morale_type &type, int bonus, int max_bonus,
         return;
     }
 
+    // The points must be of their actual age to stack with the new bonus
+    apply_pending_decay();
+
     for( auto &m : points ) {
         if( m.matches( type, item_type ) ) {
             const int prev_bonus = m.get_net_bonus();
@@ -296,6 +309,7 @@ void player_morale::add( const morale_type &type, int bonus, int max_bonus,
             } else if( m.get_net_bonus() != prev_bonus ) {
                 invalidate();
             }
+            schedule_decay();
 
             return;
         }
@@ -304,6 +318,7 @@ void player_morale::add( const morale_type &type, int bonus, int max_bonus,
     morale_point new_morale( type, item_type, bonus, max_bonus, duration, decay_start, capped );
 
     if( !new_morale.is_expired() ) {
+        decay_until_change = std::min( decay_until_change, new_morale.time_to_change() );
         points.push_back( new_morale );
         invalidate();
     }
@@ -455,14 +470,37 @@ int player_morale::get_level() const
 
 void player_morale::decay( const time_duration &ticks )
 {
-    const auto do_decay = [ &ticks ]( morale_point & m ) {
-        m.decay( ticks );
-    };
+    if( ticks < 0_turns ) {
+        debugmsg( "The function called with negative ticks %d.", to_turns<int>( ticks ) );
+        return;
+    }
 
-    std::for_each( points.begin(), points.end(), do_decay );
-    remove_expired();
+    pending_decay += ticks;
+    if( pending_decay >= decay_until_change ) {
+        apply_pending_decay();
+    }
     update_bodytemp_penalty( ticks );
-    invalidate();
+}
+
+void player_morale::apply_pending_decay()
+{
+    if( pending_decay > 0_turns ) {
+        for( morale_point &m : points ) {
+            m.decay( pending_decay );
+        }
+        pending_decay = 0_turns;
+        remove_expired();
+        invalidate();
+    }
+    schedule_decay();
+}
+
+void player_morale::schedule_decay()
+{
+    decay_until_change = calendar::INDEFINITELY_LONG_DURATION;
+    for( const morale_point &m : points ) {
+        decay_until_change = std::min( decay_until_change, m.time_to_change() );
+    }
 }
 
 void player_morale::display( int focus_eq, int pain_penalty, int fatigue_penalty )
@@ -824,6 +862,8 @@ void player_morale::clear()
     took_prozac_bad = false;
     stylish = false;
     super_fancy_items.clear();
+    pending_decay = 0_turns;
+    decay_until_change = calendar::INDEFINITELY_LONG_DURATION;
 
     invalidate();
 }
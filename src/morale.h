@@ -102,6 +102,11 @@ class player_morale
                 int get_net_bonus( const morale_mult &mult ) const;
                 bool is_expired() const;
                 bool is_permanent() const;
+                /**
+                 * How much longer this point can decay before its net bonus changes
+                 * or it expires. Indefinitely long for permanent points.
+                 */
+                time_duration time_to_change() const;
                 bool matches( const morale_type &_type, const itype *_item_type = nullptr ) const;
                 bool matches( const morale_point &mp ) const;
 
@@ -151,6 +156,9 @@ class player_morale
         void remove_if( const std::function<bool( const morale_point & )> &func );
         void remove_expired();
         void invalidate();
+        /** Applies @ref pending_decay to the points and reschedules the next decay. */
+        void apply_pending_decay();
+        void schedule_decay();
 
         void update_stylish_bonus();
         void update_squeamish_penalty();
@@ -204,6 +212,14 @@ class player_morale
         mutable int level;
         mutable bool level_is_valid;
 
+        /**
+         * Decay not yet applied to the points. Until it reaches @ref decay_until_change
+         * no point would change its net bonus or expire, so the points are left alone
+         * and the level stays valid.
+         */
+        time_duration pending_decay = 0_turns;
+        time_duration decay_until_change = 0_turns;
+
         bool took_prozac;
         bool took_prozac_bad;
         bool stylish;
@@ -168,6 +168,8 @@ void Character::set_mutations( const std::vector<trait_id> &traits )
         cached_mutations.push_back( &trait.obj() );
         mutation_effect( trait, false );
     }
+    // mutations modify vitamin rates and water weakness
+    upkeep_schedules_dirty = true;
     recalc_sight_limits();
     calc_encumbrance();
 
@@ -186,6 +188,7 @@ void Character::set_mutation( const trait_id &trait )
     my_mutations.emplace( trait, trait_data{} );
     cached_mutations.push_back( &trait.obj() );
     mutation_effect( trait, false );
+    upkeep_schedules_dirty = true;
     recalc_sight_limits();
     calc_encumbrance();
 
@@ -209,6 +212,7 @@ void Character::unset_mutation( const trait_id &trait_ )
     cached_mutations.erase( std::remove( cached_mutations.begin(), cached_mutations.end(), &mut ),
                             cached_mutations.end() );
     my_mutations.erase( iter );
+    upkeep_schedules_dirty = true;
     mutation_loss_effect( trait );
     recalc_sight_limits();
     calc_encumbrance();
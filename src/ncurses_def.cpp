@@ -289,6 +289,11 @@ input_event input_manager::get_input_event( const keyboard_mode /*preferred_keyb
         throw std::runtime_error( "input_manager::get_input_event called in test mode" );
     }
 
+    input_event requeued;
+    if( take_requeued_event( requeued ) ) {
+        return requeued;
+    }
+
     int key = ERR;
     input_event rval;
     do {
@@ -1272,6 +1272,27 @@ void options_manager::add_options_general()
 
     get_option( "AUTOSAVE_MINUTES" ).setPrerequisite( "AUTOSAVE" );
 
+#if defined(EMSCRIPTEN)
+    // The browser heap is small and can not grow indefinitely.
+    const int default_mapbuffer_budget = 256;
+#else
+    const int default_mapbuffer_budget = 0;
+#endif
+    add( "MAPBUFFER_BUDGET", "general", to_translation( "Map memory budget" ),
+         to_translation( "Approximate memory, in megabytes, the map buffer may use before the least recently visited areas outside the reality bubble are saved and dropped from memory.  0 = unlimited." ),
+         0, 4096, default_mapbuffer_budget
+       );
+
+#if defined(EMSCRIPTEN)
+    const bool default_fast_forward = true;
+#else
+    const bool default_fast_forward = false;
+#endif
+    add( "FAST_FORWARD", "general", to_translation( "Fast-forward idle time" ),
+         to_translation( "If true, while sleeping or waiting out a long activity with nothing hostile in view, monsters and fields beyond view distance are only updated once per minute, and the screen is not refreshed in between." ),
+         default_fast_forward
+       );
+
     add_empty_line();
 
     add( "AUTO_NOTES", "general", to_translation( "Auto notes" ),
@@ -1731,6 +1752,13 @@ void options_manager::add_options_graphics()
 
     get_option( "ANIMATION_DELAY" ).setPrerequisite( "ANIMATIONS" );
 
+    add( "ANIMATION_TIME_LIMIT", "graphics", to_translation( "Animation time limit" ),
+         to_translation( "The most time in ms that animations may take between two of your inputs.  Further animations are not shown until your next input." ),
+         0, 5000, 750
+       );
+
+    get_option( "ANIMATION_TIME_LIMIT" ).setPrerequisite( "ANIMATIONS" );
+
     add( "FORCE_REDRAW", "graphics", to_translation( "Force redraw" ),
          to_translation( "If true, forces the game to redraw at least once per turn." ),
          true
@@ -2250,6 +2278,11 @@ void options_manager::add_options_debug()
 
     get_option( "FOV_3D_Z_RANGE" ).setPrerequisite( "FOV_3D" );
 
+    add( "VIEWER_FOV_CACHE", "debug", to_translation( "Shared field of vision for monsters and NPCs" ),
+         to_translation( "If true, monsters and NPCs check visibility against a field of vision that is computed once per tile and shared by everyone standing there, instead of tracing a separate line to every target.  Faster with many creatures around, but the edges of vision may differ slightly." ),
+         false
+       );
+
     add( "ENCODING_CONV", "debug", to_translation( "Experimental path name encoding conversion" ),
          to_translation( "If true, file path names are going to be transcoded from system encoding to UTF-8 when reading and will be transcoded back when writing.  Mainly for CJK Windows users." ),
          true
@@ -3108,6 +3141,7 @@ static void update_options_cache()
     message_cooldown = ::get_option<int>( "MESSAGE_COOLDOWN" );
     fov_3d = ::get_option<bool>( "FOV_3D" );
     fov_3d_z_range = ::get_option<int>( "FOV_3D_Z_RANGE" );
+    viewer_fov_cache = ::get_option<bool>( "VIEWER_FOV_CACHE" );
     keycode_mode = ::get_option<std::string>( "SDL_KEYBOARD_MODE" ) == "keycode";
 }
 
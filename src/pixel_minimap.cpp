@@ -494,7 +494,8 @@ void pixel_minimap::render_critters( const tripoint &center )
         mixture = lerp_clamped( 0, 100, std::max( s, 0.0f ) );
     }
 
-    const level_cache &access_cache = get_map().access_cache( center.z );
+    const map &here = get_map();
+    const level_cache &access_cache = here.access_cache( center.z );
 
     const int start_x = center.x - total_tiles_count.x / 2;
     const int start_y = center.y - total_tiles_count.y / 2;
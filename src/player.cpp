@@ -1168,11 +1168,17 @@ void player::process_items()
     }
 
     // Active item processing done, now we're recharging.
+    // Flags can change in ways the index does not hear about (e.g. installing a UPS
+    // conversion mod), so it is rebuilt every minute regardless.
+    if( ups_items.dirty || calendar::once_every( 1_minutes ) ) {
+        update_ups_item_index();
+    }
     int ch_UPS = 0;
-    const auto inv_is_ups = items_with( []( const item & itm ) {
-        return itm.has_flag( flag_IS_UPS );
-    } );
-    for( const auto &it : inv_is_ups ) {
+    for( const safe_reference<item> &ref : ups_items.providers ) {
+        const item *it = ref.get();
+        if( it == nullptr ) {
+            continue;
+        }
         itype_id identifier = it->type->get_id();
         if( identifier == itype_UPS_off ) {
             ch_UPS += it->ammo_remaining();
@@ -1198,10 +1204,11 @@ void player::process_items()
 
     // Load all items that use the UPS to their minimal functional charge,
     // The tool is not really useful if its charges are below charges_to_use
-    const auto inv_use_ups = items_with( []( const item & itm ) {
-        return itm.has_flag( flag_USE_UPS );
-    } );
-    for( const auto &it : inv_use_ups ) {
+    for( const safe_reference<item> &ref : ups_items.consumers ) {
+        item *it = ref.get();
+        if( it == nullptr ) {
+            continue;
+        }
         // For powered armor, an armor-powering bionic should always be preferred over UPS usage.
         if( it->is_power_armor() && can_interface_armor() && has_power() ) {
             // Bionic power costs are handled elsewhere
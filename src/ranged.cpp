@@ -767,6 +767,11 @@ int player::fire_gun( const tripoint &target, int shots, item &gun )
     int curshot = 0;
     int hits = 0; // total shots on target
     int delay = 0; // delayed recoil that has yet to be applied
+    // If this is a vehicle mounted turret, which vehicle is it mounted on?
+    const vehicle *in_veh = has_effect( effect_on_roof ) ? veh_pointer_or_null( here.veh_at(
+                                pos() ) ) : nullptr;
+    // All shots of the burst share the parts of their trajectories which don't change between them
+    projectile_volley volley( pos(), in_veh );
     while( curshot != shots ) {
         if( gun.has_fault_flag( "JAMMED_GUN" ) && curshot == 0 ) {
             moves -= 50;
@@ -781,12 +786,8 @@ int player::fire_gun( const tripoint &target, int shots, item &gun )
         dispersion_sources dispersion = get_weapon_dispersion( gun );
         dispersion.add_range( recoil_total() );
 
-        // If this is a vehicle mounted turret, which vehicle is it mounted on?
-        const vehicle *in_veh = has_effect( effect_on_roof ) ? veh_pointer_or_null( here.veh_at(
-                                    pos() ) ) : nullptr;
-
         dealt_projectile_attack shot = projectile_attack( make_gun_projectile( gun ), pos(), aim,
-                                       dispersion, this, in_veh );
+                                       dispersion, this, in_veh, &volley );
         curshot++;
         if( shot.hit_critter ) {
             hits++;
@@ -43,13 +43,25 @@ void reachability_cache<Horizontal, Types...>::invalidate()
 {
     dirty_any = true;
     dirty.set();
+    for( int i = 0; i < MAPSIZE * MAPSIZE; i++ ) {
+        const point sm_start( ( i / MAPSIZE ) * SEEX, ( i % MAPSIZE ) * SEEY );
+        dirty_rects[i] = inclusive_rectangle<point>( sm_start, sm_start + point( SEEX - 1, SEEY - 1 ) );
+    }
 }
 
 template<bool Horizontal, typename... Types>
 void reachability_cache<Horizontal, Types...>::invalidate( const point &p )
 {
     dirty_any = true;
-    dirty[dirty_idx( p )] = true;
+    const int idx = dirty_idx( p );
+    inclusive_rectangle<point> &rect = dirty_rects[idx];
+    if( !dirty[idx] ) {
+        dirty[idx] = true;
+        rect = inclusive_rectangle<point>( p, p );
+        return;
+    }
+    rect.p_min = point( std::min( rect.p_min.x, p.x ), std::min( rect.p_min.y, p.y ) );
+    rect.p_max = point( std::max( rect.p_max.x, p.x ), std::max( rect.p_max.y, p.y ) );
 }
 
 template<bool Horizontal, typename... Types>
@@ -92,12 +104,22 @@ void reachability_cache<Horizontal, Types...>::rebuild( Q q,
 
             const point sm_p( smx, smy );
             point cur_sm_end = sm_p + sm_dir;
+            // A tile only depends on the tiles before it in the quadrant's direction, so if the
+            // submap was only invalidated externally, the tiles before the changed rectangle
+            // (in either axis) are still valid. Neighbors can change a whole edge, so submaps
+            // dirtied by them are rebuilt in full.
+            point sm_begin = sm_p;
+            if( !dirty_local[dirty_shift] ) {
+                const inclusive_rectangle<point> &rect = dirty_rects[dirty_shift];
+                sm_begin.x = dir.x > 0 ? rect.p_min.x : rect.p_max.x;
+                sm_begin.y = dir.y > 0 ? rect.p_min.y : rect.p_max.y;
+            }
             bool last_change = false;
             bool next_x_dirty = false;
             bool next_y_dirty = false;
             int sm_last_x = cur_sm_end.x - dir.x;
-            for( int x = smx; x != cur_sm_end.x; x += dir.x ) {
-                for( int y = start.y; y != cur_sm_end.y; y += dir.y ) {
+            for( int x = sm_begin.x; x != cur_sm_end.x; x += dir.x ) {
+                for( int y = sm_begin.y; y != cur_sm_end.y; y += dir.y ) {
                     last_change = Spec::dynamic_fun( layer, {x, y}, dir, params ... );
                     next_x_dirty |= ( x == sm_last_x ) & last_change;
                 }
@@ -158,12 +180,13 @@ template<bool Horizontal, typename... Types>
 bool reachability_cache<Horizontal, Types...>::has_potential_los(
     const point &from, const point &to, const Types &... params )
 {
+    if( Spec::source_cache_dirty( params ... ) ) {
+        // the source caches invalidate this one only when they are rebuilt, so until then
+        // the stored values may be stale (this also covers the debug overlay
+        // calling this method before transparency cache was rebuild after map shift)
+        return true;
+    }
     if( dirty_any ) {
-        if( Spec::source_cache_dirty( params ... ) ) {
-            // this is specifically to fix the issue with the debug overlay
-            // calling this method before transparency cache was rebuild after map shift
-            return true;
-        }
         rebuild( params ... );
         dirty.reset();
         dirty_any = false;
@@ -269,13 +292,13 @@ bool reachability_cache_specialization<true, level_cache>::test( int d, int cach
 bool reachability_cache_specialization<false, level_cache, level_cache>::source_cache_dirty(
     const level_cache &this_lc, const level_cache &floor_lc )
 {
-    return floor_lc.floor_cache_dirty || this_lc.transparency_cache_dirty.any();
+    return floor_lc.floor_cache_dirty || this_lc.transparency_dirty();
 }
 
 bool reachability_cache_specialization<true, level_cache>::source_cache_dirty(
     const level_cache &this_lc )
 {
-    return this_lc.transparency_cache_dirty.any();
+    return this_lc.transparency_dirty();
 }
 
 // vertical cache test
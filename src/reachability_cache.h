@@ -1,10 +1,12 @@
 #ifndef CATA_SRC_REACHABILITY_CACHE_H
 #define CATA_SRC_REACHABILITY_CACHE_H
 
+#include <array>
 #include <bitset>
 #include <cstdint>
 #include <limits>
 
+#include "cuboid_rectangle.h"
 #include "enums.h"
 #include "game_constants.h"
 
@@ -104,6 +106,9 @@ class reachability_cache
         // fields:
         // marks parts of this cache is dirty (with reduced granularity)
         std::bitset<MAPSIZE *MAPSIZE> dirty;
+        // for every dirty submap, the tiles (in map coords) invalidated in it;
+        // a rebuild only needs to start from the corner of this rectangle that faces the quadrant
+        std::array<inclusive_rectangle<point>, MAPSIZE *MAPSIZE> dirty_rects;
         bool dirty_any = true;
 
         // converts 2d coords into 1d dirty bitset coords
@@ -115,7 +120,7 @@ class reachability_cache
 
     public:
         reachability_cache() {
-            dirty.set();
+            invalidate();
         }
 
         void invalidate();
@@ -1,36 +1,52 @@
 #include "rng.h"
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 
 #include "calendar.h"
 #include "cata_utility.h"
 #include "units.h"
 
+static rng_stream current_stream = rng_stream::main;
+
 unsigned int rng_bits()
 {
     // Whole uint range.
-    static std::uniform_int_distribution<unsigned int> rng_uint_dist;
-    return rng_uint_dist( rng_get_engine() );
+    return static_cast<unsigned int>( rng_get_engine()() >> 32 );
 }
 
 int rng( int lo, int hi )
 {
-    static std::uniform_int_distribution<int> rng_int_dist;
     if( lo > hi ) {
         std::swap( lo, hi );
     }
-    return rng_int_dist( rng_get_engine(), std::uniform_int_distribution<>::param_type( lo, hi ) );
+    // Lemire's multiply-and-shift, which only needs a division for the rare
+    // rejection check instead of for every roll.
+    const std::uint64_t range = static_cast<std::uint64_t>( static_cast<std::int64_t>( hi ) - lo ) + 1;
+    cata_default_random_engine &eng = rng_get_engine();
+    std::uint64_t product = ( eng() >> 32 ) * range;
+    std::uint32_t low = static_cast<std::uint32_t>( product );
+    if( low < range ) {
+        const std::uint32_t threshold = static_cast<std::uint32_t>( ( 0x100000000ULL - range ) % range );
+        while( low < threshold ) {
+            product = ( eng() >> 32 ) * range;
+            low = static_cast<std::uint32_t>( product );
+        }
+    }
+    return static_cast<int>( lo + static_cast<std::int64_t>( product >> 32 ) );
 }
 
 double rng_float( double lo, double hi )
 {
-    static std::uniform_real_distribution<double> rng_real_dist;
     if( lo > hi ) {
         std::swap( lo, hi );
     }
-    return rng_real_dist( rng_get_engine(), std::uniform_real_distribution<>::param_type( lo, hi ) );
+    // The top 53 bits make a double in [0, 1).
+    const double unit = ( rng_get_engine()() >> 11 ) * ( 1.0 / 9007199254740992.0 );
+    return lo + unit * ( hi - lo );
 }
 
 units::angle random_direction()
@@ -127,17 +143,46 @@ double rng_normal( double lo, double hi )
     return clamp( val, lo, hi );
 }
 
+static std::array<cata_default_random_engine, static_cast<size_t>( rng_stream::num_streams )>
+&rng_engines()
+{
+    static std::array<cata_default_random_engine, static_cast<size_t>( rng_stream::num_streams )>
+    engines = []() {
+        std::array<cata_default_random_engine, static_cast<size_t>( rng_stream::num_streams )> ret;
+        // NOLINTNEXTLINE(cata-determinism)
+        const std::uint64_t seed = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        for( size_t i = 0; i < ret.size(); ++i ) {
+            ret[i].seed( seed + i );
+        }
+        return ret;
+    }();
+    return engines;
+}
+
 cata_default_random_engine &rng_get_engine()
 {
-    // NOLINTNEXTLINE(cata-determinism)
-    static cata_default_random_engine eng(
-        std::chrono::high_resolution_clock::now().time_since_epoch().count() );
-    return eng;
+    return rng_engines()[static_cast<size_t>( current_stream )];
 }
 
 void rng_set_engine_seed( unsigned int seed )
 {
     if( seed != 0 ) {
-        rng_get_engine().seed( seed );
+        // splitmix64 in seed() spreads neighbouring seeds apart, so the streams
+        // can simply take consecutive ones.
+        std::array<cata_default_random_engine, static_cast<size_t>( rng_stream::num_streams )> &engines =
+            rng_engines();
+        for( size_t i = 0; i < engines.size(); ++i ) {
+            engines[i].seed( static_cast<std::uint64_t>( seed ) + i * 0x100000000ULL );
+        }
     }
 }
+
+rng_stream_scope::rng_stream_scope( rng_stream stream ) : previous( current_stream )
+{
+    current_stream = stream;
+}
+
+rng_stream_scope::~rng_stream_scope()
+{
+    current_stream = previous;
+}
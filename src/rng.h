@@ -5,6 +5,7 @@
 #include <functional>
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
 #include <random>
@@ -19,16 +20,94 @@ struct tripoint;
 template<typename Tripoint>
 class tripoint_range;
 
+/**
+ * The xoshiro256++ generator by Blackman and Vigna: fast, with a period of 2^256 - 1
+ * and none of the low-bit patterns of linear congruential engines. It meets the
+ * requirements of a uniform random bit generator, so it works with <random>.
+ */
+class xoshiro256pp
+{
+    public:
+        using result_type = std::uint64_t;
+
+        explicit xoshiro256pp( result_type seed_value = 1 ) {
+            seed( seed_value );
+        }
+
+        /** Fills the state from `seed_value` with splitmix64, as the authors recommend. */
+        void seed( result_type seed_value ) {
+            for( result_type &word : state ) {
+                seed_value += 0x9e3779b97f4a7c15ULL;
+                result_type z = seed_value;
+                z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9ULL;
+                z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111ebULL;
+                word = z ^ ( z >> 31 );
+            }
+        }
+
+        static constexpr result_type min() {
+            return 0;
+        }
+        static constexpr result_type max() {
+            return ~result_type( 0 );
+        }
+
+        result_type operator()() {
+            const result_type result = rotl( state[0] + state[3], 23 ) + state[0];
+            const result_type t = state[1] << 17;
+            state[2] ^= state[0];
+            state[3] ^= state[1];
+            state[1] ^= state[2];
+            state[0] ^= state[3];
+            state[2] ^= t;
+            state[3] = rotl( state[3], 45 );
+            return result;
+        }
+
+    private:
+        static result_type rotl( const result_type x, const int k ) {
+            return ( x << k ) | ( x >> ( 64 - k ) );
+        }
+
+        std::array<result_type, 4> state;
+};
+
 // All PRNG functions use an engine, see the C++11 <random> header
 // By default, that engine is seeded by time on first call to such a function.
 // If this function is called with a non-zero seed then the engine will be
 // seeded (or re-seeded) with the given seed.
+// Every stream below is reseeded, each to its own sequence derived from the seed.
 void rng_set_engine_seed( unsigned int seed );
 
-using cata_default_random_engine = std::minstd_rand0;
+using cata_default_random_engine = xoshiro256pp;
+/** The engine of the currently selected stream. */
 cata_default_random_engine &rng_get_engine();
 unsigned int rng_bits();
 
+/**
+ * Independent streams of random numbers. Everything rolled while a stream is
+ * selected with @ref rng_stream_scope comes from that stream's own engine, so for
+ * example the maps generated for a seed stay the same no matter how many rolls
+ * the rest of the game made in between.
+ */
+enum class rng_stream : int {
+    main,
+    mapgen,
+    num_streams
+};
+
+/** Selects a stream for as long as it exists, then goes back to the previous one. */
+class rng_stream_scope
+{
+    public:
+        explicit rng_stream_scope( rng_stream stream );
+        ~rng_stream_scope();
+        rng_stream_scope( const rng_stream_scope & ) = delete;
+        rng_stream_scope &operator=( const rng_stream_scope & ) = delete;
+    private:
+        rng_stream previous;
+};
+
 int rng( int lo, int hi );
 double rng_float( double lo, double hi );
 
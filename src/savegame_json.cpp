@@ -553,6 +553,7 @@ void Character::load( const JsonObject &data )
 {
     data.allow_omitted_members();
     Creature::load( data );
+    upkeep_schedules_dirty = true;
 
     if( !data.read( "posx", position.x ) ) {  // uh-oh.
         debugmsg( "BAD PLAYER/NPC JSON: no 'posx'?" );
@@ -3466,13 +3467,24 @@ void player_morale::morale_point::serialize( JsonOut &json ) const
 
 void player_morale::store( JsonOut &jsout ) const
 {
-    jsout.member( "morale", points );
+    if( pending_decay == 0_turns ) {
+        jsout.member( "morale", points );
+        return;
+    }
+    std::vector<morale_point> aged = points;
+    for( morale_point &m : aged ) {
+        m.decay( pending_decay );
+    }
+    jsout.member( "morale", aged );
 }
 
 void player_morale::load( const JsonObject &jsin )
 {
     jsin.allow_omitted_members();
     jsin.read( "morale", points );
+    pending_decay = 0_turns;
+    schedule_decay();
+    invalidate();
 }
 
 struct mm_elem {
@@ -3950,6 +3962,7 @@ void event_multiset::deserialize( JsonIn &jsin )
     JsonObject jo = jsin.get_object();
     jo.allow_omitted_members();
     JsonArray events = jo.get_array( "event_counts" );
+    by_values_.entries.clear();
     if( !events.empty() && events.get_array( 0 ).has_int( 1 ) ) {
         // TEMPORARY until 0.F
         // Read legacy format with just ints
@@ -4001,7 +4014,7 @@ void submap::store( JsonOut &jsout ) const
     for( int j = 0; j < SEEY; j++ ) {
         // NOLINTNEXTLINE(modernize-loop-convert)
         for( int i = 0; i < SEEX; i++ ) {
-            const std::string this_id = ter[i][j].obj().id.str();
+            const std::string this_id = soa->ter[i][j].obj().id.str();
             if( !last_id.empty() ) {
                 if( this_id == last_id ) {
                     num_same++;
@@ -4081,12 +4094,12 @@ void submap::store( JsonOut &jsout ) const
     jsout.start_array();
     for( int j = 0; j < SEEY; j++ ) {
         for( int i = 0; i < SEEX; i++ ) {
-            if( itm[i][j].empty() ) {
+            if( soa->itm[i][j].empty() ) {
                 continue;
             }
             jsout.write( i );
             jsout.write( j );
-            jsout.write( itm[i][j] );
+            jsout.write( soa->itm[i][j] );
         }
     }
     jsout.end_array();
@@ -4114,11 +4127,11 @@ void submap::store( JsonOut &jsout ) const
     for( int j = 0; j < SEEY; j++ ) {
         for( int i = 0; i < SEEX; i++ ) {
             // Save fields
-            if( fld[i][j].field_count() > 0 ) {
+            if( soa->fld[i][j].field_count() > 0 ) {
                 jsout.write( i );
                 jsout.write( j );
                 jsout.start_array();
-                for( const auto &elem : fld[i][j] ) {
+                for( const auto &elem : soa->fld[i][j] ) {
                     const field_entry &cur = elem.second;
                     jsout.write( cur.get_field_type().id() );
                     jsout.write( cur.get_field_intensity() );
@@ -4208,6 +4221,8 @@ void submap::store( JsonOut &jsout ) const
 
 void submap::load( JsonIn &jsin, const std::string &member_name, int version )
 {
+    tile_data &tiles = writable_soa();
+    actualize_summary_dirty = true;
     bool rubpow_update = version < 22;
     if( member_name == "turn_last_touched" ) {
         last_touched = time_point( jsin.get_int() );
@@ -4225,26 +4240,26 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
                     const ter_str_id tid( jsin.get_string() );
 
                     if( tid == ter_t_rubble ) {
-                        ter[i][j] = ter_id( "t_dirt" );
-                        frn[i][j] = furn_id( "f_rubble" );
-                        itm[i][j].insert( rock );
-                        itm[i][j].insert( rock );
+                        tiles.ter[i][j] = ter_id( "t_dirt" );
+                        tiles.frn[i][j] = furn_id( "f_rubble" );
+                        tiles.itm[i][j].insert( rock );
+                        tiles.itm[i][j].insert( rock );
                     } else if( tid == ter_t_wreckage ) {
-                        ter[i][j] = ter_id( "t_dirt" );
-                        frn[i][j] = furn_id( "f_wreckage" );
-                        itm[i][j].insert( chunk );
-                        itm[i][j].insert( chunk );
+                        tiles.ter[i][j] = ter_id( "t_dirt" );
+                        tiles.frn[i][j] = furn_id( "f_wreckage" );
+                        tiles.itm[i][j].insert( chunk );
+                        tiles.itm[i][j].insert( chunk );
                     } else if( tid == ter_t_ash ) {
-                        ter[i][j] = ter_id( "t_dirt" );
-                        frn[i][j] = furn_id( "f_ash" );
+                        tiles.ter[i][j] = ter_id( "t_dirt" );
+                        tiles.frn[i][j] = furn_id( "f_ash" );
                     } else if( tid == ter_t_pwr_sb_support_l ) {
-                        ter[i][j] = ter_id( "t_support_l" );
+                        tiles.ter[i][j] = ter_id( "t_support_l" );
                     } else if( tid == ter_t_pwr_sb_switchgear_l ) {
-                        ter[i][j] = ter_id( "t_switchgear_l" );
+                        tiles.ter[i][j] = ter_id( "t_switchgear_l" );
                     } else if( tid == ter_t_pwr_sb_switchgear_s ) {
-                        ter[i][j] = ter_id( "t_switchgear_s" );
+                        tiles.ter[i][j] = ter_id( "t_switchgear_s" );
                     } else {
-                        ter[i][j] = tid.id();
+                        tiles.ter[i][j] = tid.id();
                     }
                 }
             }
@@ -4269,7 +4284,7 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
                     } else {
                         --remaining;
                     }
-                    ter[i][j] = iid;
+                    tiles.ter[i][j] = iid;
                 }
             }
             if( remaining ) {
@@ -4296,7 +4311,7 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
             jsin.start_array();
             int i = jsin.get_int();
             int j = jsin.get_int();
-            frn[i][j] = furn_id( jsin.get_string() );
+            tiles.frn[i][j] = furn_id( jsin.get_string() );
             jsin.end_array();
         }
     } else if( member_name == "items" ) {
@@ -4306,11 +4321,11 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
             int j = jsin.get_int();
             const point p( i, j );
 
-            if( !jsin.read( itm[p.x][p.y], false ) ) {
+            if( !jsin.read( tiles.itm[p.x][p.y], false ) ) {
                 debugmsg( "Items array is corrupt in submap at: %s, skipping", p.to_string() );
             }
             // some portion could've been read even if error occurred
-            for( item &it : itm[p.x][p.y] ) {
+            for( item &it : tiles.itm[p.x][p.y] ) {
                 if( it.is_emissive() ) {
                     update_lum_add( p, it );
                 }
@@ -4332,7 +4347,7 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
             const point p( i, j );
             // TODO: jsin should support returning an id like jsin.get_id<trap>()
             const trap_str_id trid( jsin.get_string() );
-            trp[p.x][p.y] = trid.id();
+            tiles.trp[p.x][p.y] = trid.id();
             jsin.end_array();
         }
     } else if( member_name == "fields" ) {
@@ -4359,7 +4374,7 @@ void submap::load( JsonIn &jsin, const std::string &member_name, int version )
                 } else {
                     ft = field_types::get_field_type_by_legacy_enum( type_int ).id;
                 }
-                if( fld[i][j].add_field( ft, intensity, time_duration::from_turns( age ) ) ) {
+                if( tiles.fld[i][j].add_field( ft, intensity, time_duration::from_turns( age ) ) ) {
                     field_count++;
                 }
             }
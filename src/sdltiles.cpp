@@ -60,6 +60,7 @@
 #include "sdl_wrappers.h"
 #include "sdl_font.h"
 #include "sdlsound.h"
+#include "sounds.h"
 #include "string_formatter.h"
 #include "ui_manager.h"
 #include "wcwidth.h"
@@ -2162,6 +2163,14 @@ static void CheckMessages()
         return;
     }
 
+    // Start the sound effects that have become due, e.g. hits following melee swings.
+    sfx::play_scheduled_sounds();
+
+    // Load the next part of a tileset that is being streamed in, one chunk per call.
+    if( tilecontext && tilecontext->continue_tileset_loading() ) {
+        needupdate = true;
+    }
+
 #if defined(__ANDROID__)
     if( visible_display_frame_dirty ) {
         needupdate = true;
@@ -3075,9 +3084,10 @@ void load_tileset()
     if( !tilecontext || !use_tiles ) {
         return;
     }
+    // The tile images are decoded while the rest of the game data loads, see CheckMessages.
     tilecontext->load_tileset( get_option<std::string>( "TILES" ),
                                /*precheck=*/false, /*force=*/false,
-                               /*pump_events=*/true );
+                               /*pump_events=*/true, /*stream=*/true );
     tilecontext->do_tile_loading_report();
 }
 
@@ -3130,6 +3140,11 @@ input_event input_manager::get_input_event( const keyboard_mode preferred_keyboa
         throw std::runtime_error( "input_manager::get_input_event called in test mode" );
     }
 
+    input_event requeued;
+    if( take_requeued_event( requeued ) ) {
+        return requeued;
+    }
+
 #if !defined(__ANDROID__) && !defined(TARGET_OS_IPHONE)
     if( actual_keyboard_mode( preferred_keyboard_mode ) == keyboard_mode::keychar ) {
         SDL_StartTextInput();
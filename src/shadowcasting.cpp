@@ -148,7 +148,7 @@ template<int xx_transform, int xy_transform, int yx_transform, int yy_transform,
 void cast_horizontal_zlight_segment(
     const array_of_grids_of<T> &output_caches,
     const array_of_grids_of<const T> &input_arrays,
-    const array_of_grids_of<const bool> &floor_caches,
+    const array_of_bitset_grids &floor_caches,
     const tripoint &offset, const int offset_distance,
     const T numerator )
 {
@@ -331,7 +331,7 @@ template<int x_transform, int y_transform, int z_transform, typename T,
 void cast_vertical_zlight_segment(
     const array_of_grids_of<T> &output_caches,
     const array_of_grids_of<const T> &input_arrays,
-    const array_of_grids_of<const bool> &floor_caches,
+    const array_of_bitset_grids &floor_caches,
     const tripoint &offset, const int offset_distance,
     const T numerator )
 {
@@ -496,7 +496,7 @@ template<typename T, T( *calc )( const T &, const T &, const int & ),
 void cast_zlight(
     const array_of_grids_of<T> &output_caches,
     const array_of_grids_of<const T> &input_arrays,
-    const array_of_grids_of<const bool> &floor_caches,
+    const array_of_bitset_grids &floor_caches,
     const tripoint &origin, const int offset_distance, const T numerator, vertical_direction dir )
 {
     if( dir == vertical_direction::DOWN || dir == vertical_direction::BOTH ) {
@@ -629,7 +629,7 @@ void cast_zlight(
 template void cast_zlight<float, sight_calc, sight_check, accumulate_transparency>(
     const std::array<float ( * )[MAPSIZE_X][MAPSIZE_Y], OVERMAP_LAYERS> &output_caches,
     const std::array<const float ( * )[MAPSIZE_X][MAPSIZE_Y], OVERMAP_LAYERS> &input_arrays,
-    const std::array<const bool ( * )[MAPSIZE_X][MAPSIZE_Y], OVERMAP_LAYERS> &floor_caches,
+    const array_of_bitset_grids &floor_caches,
     const tripoint &origin, int offset_distance, float numerator,
     vertical_direction dir );
 
@@ -637,6 +637,6 @@ template void cast_zlight<fragment_cloud, shrapnel_calc, shrapnel_check, accumul
     const std::array<fragment_cloud( * )[MAPSIZE_X][MAPSIZE_Y], OVERMAP_LAYERS> &output_caches,
     const std::array<const fragment_cloud( * )[MAPSIZE_X][MAPSIZE_Y], OVERMAP_LAYERS>
     &input_arrays,
-    const std::array<const bool ( * )[MAPSIZE_X][MAPSIZE_Y], OVERMAP_LAYERS> &floor_caches,
+    const array_of_bitset_grids &floor_caches,
     const tripoint &origin, int offset_distance, fragment_cloud numerator,
     vertical_direction dir );
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <array>
+#include <bitset>
 #include <cmath>
 #include <functional>
 #include <iosfwd>
@@ -113,6 +114,8 @@ inline float accumulate_transparency( const float &cumulative_transparency,
     return ( ( distance - 1 ) * cumulative_transparency + current_transparency ) / distance;
 }
 
+// Casts from offset in all eight octants. The cast reaches 60 - offsetDistance rows,
+// or max_radius rows if that is smaller, without changing the distances passed to calc.
 template<typename T, typename Out, T( *calc )( const T &, const T &, const int & ),
          bool( *check )( const T &, const T & ),
          void( *update_output )( Out &, const T &, quadrant ),
@@ -120,11 +123,15 @@ template<typename T, typename Out, T( *calc )( const T &, const T &, const int &
 void castLightAll( Out( &output_cache )[MAPSIZE_X][MAPSIZE_Y],
                    const T( &input_array )[MAPSIZE_X][MAPSIZE_Y],
                    const point &offset, int offsetDistance = 0,
-                   T numerator = 1.0 );
+                   T numerator = 1.0, int max_radius = -1 );
 
 template<typename T>
 using array_of_grids_of = std::array<T( * )[MAPSIZE_X][MAPSIZE_Y], OVERMAP_LAYERS>;
 
+// A grid of flags, one bit per tile, indexed as grid[x][y] like the other grids.
+using bitset_grid = std::array<std::bitset<MAPSIZE_Y>, MAPSIZE_X>;
+using array_of_bitset_grids = std::array<const bitset_grid *, OVERMAP_LAYERS>;
+
 // TODO: Generalize the floor check, allow semi-transparent floors
 template< typename T, T( *calc )( const T &, const T &, const int & ),
           bool( *check )( const T &, const T & ),
@@ -132,7 +139,7 @@ template< typename T, T( *calc )( const T &, const T &, const int & ),
 void cast_zlight(
     const array_of_grids_of<T> &output_caches,
     const array_of_grids_of<const T> &input_arrays,
-    const array_of_grids_of<const bool> &floor_caches,
+    const array_of_bitset_grids &floor_caches,
     const tripoint &origin, int offset_distance, T numerator,
     vertical_direction dir = vertical_direction::BOTH );
 
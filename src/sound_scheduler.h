@@ -0,0 +1,73 @@
+#pragma once
+#ifndef CATA_SRC_SOUND_SCHEDULER_H
+#define CATA_SRC_SOUND_SCHEDULER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * Sound effects waiting to be started at a later point in real time, kept in a heap ordered by
+ * their start time.
+ *
+ * Delayed and layered sound effects (a swing followed by the hit a moment later) are scheduled
+ * here and started by whoever drains the queue, usually the main loop, so they need neither
+ * threads nor sleeping.
+ */
+template<typename Sound>
+class sound_scheduler
+{
+    public:
+        using clock = std::chrono::steady_clock;
+
+        void clear() {
+            heap.clear();
+        }
+
+        bool empty() const {
+            return heap.empty();
+        }
+
+        size_t size() const {
+            return heap.size();
+        }
+
+        /** Schedules `sound` to be started at `start`. */
+        void schedule( const clock::time_point &start, const Sound &sound ) {
+            heap.push_back( entry{ start, next_seq++, sound } );
+            std::push_heap( heap.begin(), heap.end(), starts_later );
+        }
+
+        /**
+         * Calls `fn( sound, start )` for every sound whose start is not after `now`, earliest
+         * first. Sounds with the same start are passed in the order they were scheduled.
+         * Each sound is removed before `fn` is called, so it may schedule further sounds.
+         */
+        template<typename F>
+        void play_due( const clock::time_point &now, F fn ) {
+            while( !heap.empty() && heap.front().start <= now ) {
+                std::pop_heap( heap.begin(), heap.end(), starts_later );
+                const entry e = heap.back();
+                heap.pop_back();
+                fn( e.sound, e.start );
+            }
+        }
+
+    private:
+        struct entry {
+            clock::time_point start;
+            uint64_t seq;
+            Sound sound;
+        };
+
+        static bool starts_later( const entry &lhs, const entry &rhs ) {
+            return lhs.start != rhs.start ? lhs.start > rhs.start : lhs.seq > rhs.seq;
+        }
+
+        std::vector<entry> heap;
+        uint64_t next_seq = 0;
+};
+
+#endif // CATA_SRC_SOUND_SCHEDULER_H
@@ -49,10 +49,7 @@
 #   else
 #      include <SDL_mixer.h>
 #   endif
-#   include <thread>
-#   if defined(_WIN32) && !defined(_MSC_VER)
-#       include "mingw.thread.h"
-#   endif
+#   include "sound_scheduler.h"
 
 #   define dbg(x) DebugLog((x),D_SDL) << __FILE__ << ":" << __LINE__ << ": "
 
@@ -1052,27 +1049,37 @@ void sfx::generate_gun_sound( const player &source_arg, const item &firing )
 
 namespace sfx
 {
-struct sound_thread {
-    sound_thread( const tripoint &source, const tripoint &target, bool hit, bool targ_mon,
-                  const std::string &material );
+/** Arguments of a delayed call to @ref play_variant_sound. */
+struct scheduled_sound {
+    std::string id;
+    std::string variant;
+    int volume;
+    units::angle angle;
+};
 
-    bool hit;
-    bool targ_mon;
-    std::string material;
+static sound_scheduler<scheduled_sound> &scheduled_sounds()
+{
+    static sound_scheduler<scheduled_sound> sounds;
+    return sounds;
+}
 
-    skill_id weapon_skill;
-    int weapon_volume;
-    // volume and angle for calls to play_variant_sound
-    units::angle ang_src;
-    int vol_src;
-    int vol_targ;
-    units::angle ang_targ;
+using sound_clock = sound_scheduler<scheduled_sound>::clock;
 
-    // Operator overload required for thread API.
-    void operator()() const;
-};
+static void schedule_variant_sound( const sound_clock::time_point &start, const std::string &id,
+                                    const std::string &variant, int volume, units::angle angle )
+{
+    scheduled_sounds().schedule( start, scheduled_sound{ id, variant, volume, angle } );
+}
 } // namespace sfx
 
+void sfx::play_scheduled_sounds()
+{
+    scheduled_sounds().play_due( sound_clock::now(),
+    []( const scheduled_sound & snd, const sound_clock::time_point & ) {
+        play_variant_sound( snd.id, snd.variant, snd.volume, snd.angle, 0.8, 1.2 );
+    } );
+}
+
 void sfx::generate_melee_sound( const tripoint &source, const tripoint &target, bool hit,
                                 bool targ_mon,
                                 const std::string &material )
@@ -1080,35 +1087,14 @@ void sfx::generate_melee_sound( const tripoint &source, const tripoint &target,
     if( test_mode ) {
         return;
     }
-    // If creating a new thread for each invocation is to much, we have to consider a thread
-    // pool or maybe a single thread that works continuously, but that requires a queue or similar
-    // to coordinate its work.
-    try {
-        std::thread the_thread( sound_thread( source, target, hit, targ_mon, material ) );
-        try {
-            if( the_thread.joinable() ) {
-                the_thread.detach();
-            }
-        } catch( std::system_error &err ) {
-            dbg( D_ERROR ) << "Failed to detach melee sound thread: std::system_error: " << err.what();
-        }
-    } catch( std::system_error &err ) {
-        // not a big deal, just skip playing the sound.
-        dbg( D_ERROR ) << "Failed to create melee sound thread: std::system_error: " << err.what();
-    }
-}
-
-sfx::sound_thread::sound_thread( const tripoint &source, const tripoint &target, const bool hit,
-                                 const bool targ_mon, const std::string &material )
-    : hit( hit )
-    , targ_mon( targ_mon )
-    , material( material )
-{
-    // This is function is run in the main thread.
     const int heard_volume = get_heard_volume( source );
     npc *np = g->critter_at<npc>( source );
     const player &p = np ? static_cast<player &>( *np ) :
                       dynamic_cast<player &>( get_player_character() );
+    // volume and angle of the swing and of the hit
+    units::angle ang_src;
+    int vol_src;
+    int vol_targ;
     if( !p.is_npc() ) {
         // sound comes from the same place as the player is, calculation of angle wouldn't work
         ang_src = 0_degrees;
@@ -1119,57 +1105,43 @@ sfx::sound_thread::sound_thread( const tripoint &source, const tripoint &target,
         vol_src = std::max( heard_volume - 30, 0 );
         vol_targ = std::max( heard_volume - 20, 0 );
     }
-    ang_targ = get_heard_angle( target );
-    weapon_skill = p.weapon.melee_skill();
-    weapon_volume = p.weapon.volume() / units::legacy_volume_factor;
-}
-
-// Operator overload required for thread API.
-void sfx::sound_thread::operator()() const
-{
-    // This is function is run in a separate thread. One must be careful and not access game data
-    // that might change (e.g. g->u.weapon, the character could switch weapons while this thread
-    // runs).
-    std::this_thread::sleep_for( std::chrono::milliseconds( rng( 1, 2 ) ) );
-    std::string variant_used;
+    const units::angle ang_targ = get_heard_angle( target );
+    const skill_id weapon_skill = p.weapon.melee_skill();
+    const int weapon_volume = p.weapon.volume() / units::legacy_volume_factor;
 
     static const skill_id skill_bashing( "bashing" );
     static const skill_id skill_cutting( "cutting" );
     static const skill_id skill_stabbing( "stabbing" );
 
+    std::string variant_used;
     if( weapon_skill == skill_bashing && weapon_volume <= 8 ) {
         variant_used = "small_bash";
-        play_variant_sound( "melee_swing", "small_bash", vol_src, ang_src, 0.8, 1.2 );
     } else if( weapon_skill == skill_bashing && weapon_volume >= 9 ) {
         variant_used = "big_bash";
-        play_variant_sound( "melee_swing", "big_bash", vol_src, ang_src, 0.8, 1.2 );
     } else if( ( weapon_skill == skill_cutting || weapon_skill == skill_stabbing ) &&
                weapon_volume <= 6 ) {
         variant_used = "small_cutting";
-        play_variant_sound( "melee_swing", "small_cutting", vol_src, ang_src, 0.8, 1.2 );
     } else if( ( weapon_skill == skill_cutting || weapon_skill == skill_stabbing ) &&
                weapon_volume >= 7 ) {
         variant_used = "big_cutting";
-        play_variant_sound( "melee_swing", "big_cutting", vol_src, ang_src, 0.8, 1.2 );
     } else {
         variant_used = "default";
-        play_variant_sound( "melee_swing", "default", vol_src, ang_src, 0.8, 1.2 );
     }
+
+    // The swing starts right away, the hit follows once the weapon has travelled.
+    using std::chrono::milliseconds;
+    const sound_clock::time_point swing_start = sound_clock::now() + milliseconds( rng( 1, 2 ) );
+    schedule_variant_sound( swing_start, "melee_swing", variant_used, vol_src, ang_src );
     if( hit ) {
         if( targ_mon ) {
-            if( material == "steel" ) {
-                std::this_thread::sleep_for( std::chrono::milliseconds( rng( weapon_volume * 12,
-                                             weapon_volume * 16 ) ) );
-                play_variant_sound( "melee_hit_metal", variant_used, vol_targ, ang_targ, 0.8, 1.2 );
-            } else {
-                std::this_thread::sleep_for( std::chrono::milliseconds( rng( weapon_volume * 12,
-                                             weapon_volume * 16 ) ) );
-                play_variant_sound( "melee_hit_flesh", variant_used, vol_targ, ang_targ, 0.8, 1.2 );
-            }
+            const milliseconds delay( rng( weapon_volume * 12, weapon_volume * 16 ) );
+            schedule_variant_sound( swing_start + delay,
+                                    material == "steel" ? "melee_hit_metal" : "melee_hit_flesh",
+                                    variant_used, vol_targ, ang_targ );
         } else {
-            std::this_thread::sleep_for( std::chrono::milliseconds( rng( weapon_volume * 9,
-                                         weapon_volume * 12 ) ) );
-            play_variant_sound( "melee_hit_flesh", variant_used, vol_targ, ang_targ, 0.8, 1.2 );
+            const milliseconds delay( rng( weapon_volume * 9, weapon_volume * 12 ) );
+            schedule_variant_sound( swing_start + delay, "melee_hit_flesh", variant_used, vol_targ,
+                                    ang_targ );
         }
     }
 }
@@ -1587,6 +1559,7 @@ void sfx::end_activity_sounds() { }
 void sfx::generate_gun_sound( const player &, const item & ) { }
 void sfx::generate_melee_sound( const tripoint &, const tripoint &, bool, bool,
                                 const std::string & ) { }
+void sfx::play_scheduled_sounds() { }
 void sfx::do_hearing_loss( int ) { }
 void sfx::remove_hearing_loss() { }
 void sfx::do_projectile_hit( const Creature & ) { }
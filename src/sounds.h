@@ -143,6 +143,8 @@ void end_activity_sounds();
 void generate_gun_sound( const player &source_arg, const item &firing );
 void generate_melee_sound( const tripoint &source, const tripoint &target, bool hit,
                            bool targ_mon = false, const std::string &material = "flesh" );
+// Starts the sounds scheduled to be played by now, like the hits following melee swings.
+void play_scheduled_sounds();
 void do_hearing_loss( int turns = -1 );
 void remove_hearing_loss();
 void do_projectile_hit( const Creature &target );
@@ -186,7 +186,16 @@ cata::optional<event_multiset::summaries_type::value_type> event_multiset::last(
 
 void event_multiset::add( const cata::event &e )
 {
-    summaries_[e.data()].add( e );
+    if( !e.from_spec() ) {
+        summaries_[e.data()].add( e );
+        return;
+    }
+    auto it = by_values_.entries.find( e.values() );
+    if( it == by_values_.entries.end() ) {
+        event_summary &summary = summaries_[e.data()];
+        it = by_values_.entries.emplace( e.values(), &summary ).first;
+    }
+    it->second->add( e );
 }
 
 void event_multiset::add( const summaries_type::value_type &e )
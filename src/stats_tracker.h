@@ -101,6 +101,24 @@ class event_multiset
     private:
         event_type type_;
         summaries_type summaries_;
+        /**
+         * The entries of @ref summaries_ by the inline values of the events made
+         * through cata::event::make that went into them.  Those all share the
+         * keys of the event type, so the values alone identify the entry and
+         * recording another such event does not need its map form.
+         */
+        struct values_index {
+            std::unordered_map<cata::event::field_values, event_summary *, cata::range_hash> entries;
+
+            values_index() = default;
+            // A copy would point into the summaries it was copied from.
+            values_index( const values_index & ) {}
+            values_index &operator=( const values_index & ) {
+                entries.clear();
+                return *this;
+            }
+        };
+        values_index by_values_;
 };
 
 class base_watcher
@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "basecamp.h"
+#include "debug.h"
 #include "mapdata.h"
 #include "tileray.h"
 #include "trap.h"
@@ -25,17 +26,61 @@ void maptile_soa<sx, sy>::swap_soa_tile( const point &p1, const point &p2 )
     std::swap( rad[p1.x][p1.y], rad[p2.x][p2.y] );
 }
 
-submap::submap()
+submap::submap() : soa( std::make_shared<tile_data>() )
 {
-    std::uninitialized_fill_n( &ter[0][0], elements, t_null );
-    std::uninitialized_fill_n( &frn[0][0], elements, f_null );
-    std::uninitialized_fill_n( &lum[0][0], elements, 0 );
-    std::uninitialized_fill_n( &trp[0][0], elements, tr_null );
-    std::uninitialized_fill_n( &rad[0][0], elements, 0 );
+    std::uninitialized_fill_n( &soa->ter[0][0], elements, t_null );
+    std::uninitialized_fill_n( &soa->frn[0][0], elements, f_null );
+    std::uninitialized_fill_n( &soa->lum[0][0], elements, 0 );
+    std::uninitialized_fill_n( &soa->trp[0][0], elements, tr_null );
+    std::uninitialized_fill_n( &soa->rad[0][0], elements, 0 );
 
     is_uniform = false;
 }
 
+void submap::set_uniform( const ter_id &terr )
+{
+    // One set of tiles per terrain, kept for the rest of the game
+    static std::map<ter_id, std::shared_ptr<tile_data>> uniform_tiles;
+    std::shared_ptr<tile_data> &shared = uniform_tiles[terr];
+    if( !shared ) {
+        submap blank;
+        blank.set_all_ter( terr );
+        shared = blank.soa;
+    }
+    soa = shared;
+    is_uniform = true;
+    actualize_summary_dirty = true;
+}
+
+void submap::report_shared_tiles()
+{
+    debugmsg( "Items or fields of a uniform submap requested for writing before unshare_tiles" );
+    unshare_tiles();
+}
+
+const submap::actualize_summary &submap::get_actualize_summary()
+{
+    if( !actualize_summary_dirty ) {
+        return actualize_summary_;
+    }
+    static const ter_str_id t_tree_maple_tapped( "t_tree_maple_tapped" );
+    actualize_summary &sum = actualize_summary_;
+    sum = actualize_summary();
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            const ter_t &ter = soa->ter[x][y].obj();
+            const furn_t &furn = soa->frn[x][y].obj();
+            sum.emitters |= !ter.emissions.empty() || !furn.emissions.empty();
+            sum.traps |= soa->trp[x][y] != tr_null || ( ter.trap != tr_null && ter.trap != tr_ledge );
+            sum.plants |= furn.has_flag( "PLANT" );
+            sum.regrowing |= ter.has_flag( TFLAG_HARVESTED ) || ter.id == t_tree_maple_tapped;
+            sum.radiation |= soa->rad[x][y] != 0;
+        }
+    }
+    actualize_summary_dirty = false;
+    return sum;
+}
+
 submap::submap( submap && ) = default;
 submap::~submap() = default;
 
@@ -105,7 +150,7 @@ void submap::delete_graffiti( const point &p )
 }
 bool submap::has_signage( const point &p ) const
 {
-    if( frn[p.x][p.y].obj().has_flag( "SIGN" ) ) {
+    if( soa->frn[p.x][p.y].obj().has_flag( "SIGN" ) ) {
         return find_cosmetic( cosmetics, p, COSMETICS_SIGNAGE ).result;
     }
 
@@ -113,7 +158,7 @@ bool submap::has_signage( const point &p ) const
 }
 std::string submap::get_signage( const point &p ) const
 {
-    if( frn[p.x][p.y].obj().has_flag( "SIGN" ) ) {
+    if( soa->frn[p.x][p.y].obj().has_flag( "SIGN" ) ) {
         const cosmetic_find_result fresult = find_cosmetic( cosmetics, p, COSMETICS_SIGNAGE );
         if( fresult.result ) {
             return cosmetics[ fresult.ndx ].str;
@@ -148,7 +193,7 @@ void submap::update_legacy_computer()
     if( legacy_computer ) {
         for( int x = 0; x < SEEX; ++x ) {
             for( int y = 0; y < SEEY; ++y ) {
-                if( frn[x][y] == furn_str_id( "f_console" ) ) {
+                if( soa->frn[x][y] == furn_str_id( "f_console" ) ) {
                     computers.emplace( point( x, y ), *legacy_computer );
                 }
             }
@@ -159,7 +204,7 @@ void submap::update_legacy_computer()
 
 bool submap::has_computer( const point &p ) const
 {
-    return computers.find( p ) != computers.end() || ( legacy_computer && frn[p.x][p.y]
+    return computers.find( p ) != computers.end() || ( legacy_computer && soa->frn[p.x][p.y]
             == furn_str_id( "f_console" ) );
 }
 
@@ -171,7 +216,7 @@ const computer *submap::get_computer( const point &p ) const
     if( it != computers.end() ) {
         return &it->second;
     }
-    if( legacy_computer && frn[p.x][p.y] == furn_str_id( "f_console" ) ) {
+    if( legacy_computer && soa->frn[p.x][p.y] == furn_str_id( "f_console" ) ) {
         return legacy_computer.get();
     }
     return nullptr;
@@ -216,6 +261,29 @@ bool submap::contains_vehicle( vehicle *veh )
     return match != vehicles.end();
 }
 
+size_t submap::estimated_memory_usage() const
+{
+    // Each map node carries roughly three pointers and a color flag besides its value.
+    constexpr size_t map_node_overhead = 4 * sizeof( void * );
+    // Shared tiles are split between the submaps using them
+    size_t result = sizeof( submap ) + sizeof( tile_data ) / soa.use_count();
+    for( int x = 0; x < SEEX; x++ ) {
+        for( int y = 0; y < SEEY; y++ ) {
+            result += soa->itm[x][y].size() * sizeof( item );
+            result += soa->fld[x][y].field_count() *
+                      ( sizeof( std::pair<const field_type_id, field_entry> ) + map_node_overhead );
+        }
+    }
+    for( const std::unique_ptr<vehicle> &veh : vehicles ) {
+        result += sizeof( vehicle ) + veh->part_count() * sizeof( vehicle_part );
+    }
+    result += cosmetics.size() * sizeof( cosmetic_t );
+    result += spawns.size() * sizeof( spawn_point );
+    result += computers.size() * ( sizeof( computer ) + map_node_overhead );
+    result += partial_constructions.size() * ( sizeof( partial_con ) + map_node_overhead );
+    return result;
+}
+
 void submap::rotate( int turns )
 {
     turns = turns % 4;
@@ -230,19 +298,20 @@ void submap::rotate( int turns )
     const auto rotate_point_ccw = [turns]( const point & p ) {
         return p.rotate( 4 - turns, { SEEX, SEEY } );
     };
+    tile_data &tiles = writable_soa();
 
     if( turns == 2 ) {
         // Swap horizontal stripes.
         for( int j = 0, je = SEEY / 2; j < je; ++j ) {
             for( int i = j, ie = SEEX - j; i < ie; ++i ) {
-                swap_soa_tile( { i, j }, rotate_point( { i, j } ) );
+                tiles.swap_soa_tile( { i, j }, rotate_point( { i, j } ) );
             }
         }
         // Swap vertical stripes so that they don't overlap with
         // the already swapped horizontals.
         for( int i = 0, ie = SEEX / 2; i < ie; ++i ) {
             for( int j = i + 1, je = SEEY - i - 1; j < je; ++j ) {
-                swap_soa_tile( { i, j }, rotate_point( { i, j } ) );
+                tiles.swap_soa_tile( { i, j }, rotate_point( { i, j } ) );
             }
         }
     } else {
@@ -255,7 +324,7 @@ void submap::rotate( int turns )
                 for( int k = 0; k < 3; ++k ) {
                     p = pp;
                     pp = rotate_point_ccw( pp );
-                    swap_soa_tile( p, pp );
+                    tiles.swap_soa_tile( p, pp );
                 }
             }
         }
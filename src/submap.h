@@ -61,7 +61,7 @@ struct maptile_soa {
     void swap_soa_tile( const point &p1, const point &p2 );
 };
 
-class submap : maptile_soa<SEEX, SEEY>
+class submap
 {
     public:
         submap();
@@ -71,66 +71,79 @@ class submap : maptile_soa<SEEX, SEEY>
         submap &operator=( submap && );
 
         trap_id get_trap( const point &p ) const {
-            return trp[p.x][p.y];
+            return soa->trp[p.x][p.y];
         }
 
         void set_trap( const point &p, trap_id trap ) {
             is_uniform = false;
-            trp[p.x][p.y] = trap;
+            actualize_summary_dirty = true;
+            writable_soa().trp[p.x][p.y] = trap;
         }
 
         void set_all_traps( const trap_id &trap ) {
-            std::uninitialized_fill_n( &trp[0][0], elements, trap );
+            actualize_summary_dirty = true;
+            std::uninitialized_fill_n( &writable_soa().trp[0][0], elements, trap );
         }
 
         furn_id get_furn( const point &p ) const {
-            return frn[p.x][p.y];
+            return soa->frn[p.x][p.y];
         }
 
         void set_furn( const point &p, furn_id furn ) {
             is_uniform = false;
-            frn[p.x][p.y] = furn;
+            actualize_summary_dirty = true;
+            writable_soa().frn[p.x][p.y] = furn;
         }
 
         void set_all_furn( const furn_id &furn ) {
-            std::uninitialized_fill_n( &frn[0][0], elements, furn );
+            actualize_summary_dirty = true;
+            std::uninitialized_fill_n( &writable_soa().frn[0][0], elements, furn );
         }
 
         ter_id get_ter( const point &p ) const {
-            return ter[p.x][p.y];
+            return soa->ter[p.x][p.y];
         }
 
         void set_ter( const point &p, ter_id terr ) {
             is_uniform = false;
-            ter[p.x][p.y] = terr;
+            actualize_summary_dirty = true;
+            writable_soa().ter[p.x][p.y] = terr;
         }
 
         void set_all_ter( const ter_id &terr ) {
-            std::uninitialized_fill_n( &ter[0][0], elements, terr );
+            actualize_summary_dirty = true;
+            std::uninitialized_fill_n( &writable_soa().ter[0][0], elements, terr );
         }
 
+        /**
+         * Turns this into a uniform submap of the given terrain. Its tiles are shared with
+         * every other uniform submap of that terrain until one of them is written to.
+         */
+        void set_uniform( const ter_id &terr );
+
         int get_radiation( const point &p ) const {
-            return rad[p.x][p.y];
+            return soa->rad[p.x][p.y];
         }
 
         void set_radiation( const point &p, const int radiation ) {
             is_uniform = false;
-            rad[p.x][p.y] = radiation;
+            actualize_summary_dirty = true;
+            writable_soa().rad[p.x][p.y] = radiation;
         }
 
         uint8_t get_lum( const point &p ) const {
-            return lum[p.x][p.y];
+            return soa->lum[p.x][p.y];
         }
 
         void set_lum( const point &p, uint8_t luminance ) {
             is_uniform = false;
-            lum[p.x][p.y] = luminance;
+            writable_soa().lum[p.x][p.y] = luminance;
         }
 
         void update_lum_add( const point &p, const item &i ) {
             is_uniform = false;
-            if( i.is_emissive() && lum[p.x][p.y] < 255 ) {
-                lum[p.x][p.y]++;
+            if( i.is_emissive() && soa->lum[p.x][p.y] < 255 ) {
+                writable_soa().lum[p.x][p.y]++;
             }
         }
 
@@ -138,41 +151,62 @@ class submap : maptile_soa<SEEX, SEEY>
             is_uniform = false;
             if( !i.is_emissive() ) {
                 return;
-            } else if( lum[p.x][p.y] && lum[p.x][p.y] < 255 ) {
-                lum[p.x][p.y]--;
+            }
+            uint8_t &l = writable_soa().lum[p.x][p.y];
+            if( l && l < 255 ) {
+                l--;
                 return;
             }
 
             // Have to scan through all items to be sure removing i will actually lower
             // the count below 255.
             int count = 0;
-            for( const auto &it : itm[p.x][p.y] ) {
+            for( const auto &it : soa->itm[p.x][p.y] ) {
                 if( it.is_emissive() ) {
                     count++;
                 }
             }
 
             if( count <= 256 ) {
-                lum[p.x][p.y] = static_cast<uint8_t>( count - 1 );
+                l = static_cast<uint8_t>( count - 1 );
             }
         }
 
         // TODO: Replace this as it essentially makes itm public
+        // Only for tiles that are not shared, see unshare_tiles
         cata::colony<item> &get_items( const point &p ) {
-            return itm[p.x][p.y];
+            return owned_soa().itm[p.x][p.y];
         }
 
         const cata::colony<item> &get_items( const point &p ) const {
-            return itm[p.x][p.y];
+            return soa->itm[p.x][p.y];
         }
 
         // TODO: Replace this as it essentially makes fld public
+        // Only for tiles that are not shared, see unshare_tiles
         field &get_field( const point &p ) {
-            return fld[p.x][p.y];
+            return owned_soa().fld[p.x][p.y];
         }
 
         const field &get_field( const point &p ) const {
-            return fld[p.x][p.y];
+            return soa->fld[p.x][p.y];
+        }
+
+        /** True while the tiles are shared with other uniform submaps. */
+        bool shares_tiles() const {
+            return soa.use_count() > 1;
+        }
+
+        /**
+         * Gives this submap its own copy of tiles it shares with other uniform submaps, which
+         * makes it non-uniform. Items and fields are only added after this: shared tiles never
+         * hold any, so the non-const get_items and get_field refuse to hand them out.
+         */
+        void unshare_tiles() {
+            if( shares_tiles() ) {
+                soa = std::make_shared<tile_data>( *soa );
+                is_uniform = false;
+            }
         }
 
         struct cosmetic_t {
@@ -223,6 +257,37 @@ class submap : maptile_soa<SEEX, SEEY>
 
         bool contains_vehicle( vehicle * );
 
+        /**
+         * Which of the per-tile steps of @ref map::actualize have anything to do on
+         * this submap. Fields are not included, @ref field_count covers them.
+         */
+        struct actualize_summary {
+            // Terrain or furniture that emits fields
+            bool emitters = false;
+            // Traps, including those that come with the terrain; funnels are traps too
+            bool traps = false;
+            // Planted furniture
+            bool plants = false;
+            // Harvested terrain waiting to restock, and tapped maples
+            bool regrowing = false;
+            bool radiation = false;
+
+            bool any() const {
+                return emitters || traps || plants || regrowing || radiation;
+            }
+        };
+        /**
+         * The summary of the current tiles. It is worked out again after terrain,
+         * furniture, traps or radiation were changed, otherwise it is kept.
+         */
+        const actualize_summary &get_actualize_summary();
+
+        /**
+         * Rough estimate of the memory owned by this submap, in bytes. Counts the fixed
+         * tile arrays plus the items, fields, vehicles and other per-submap containers.
+         */
+        size_t estimated_memory_usage() const;
+
         void rotate( int turns );
 
         void store( JsonOut &jsout ) const;
@@ -249,10 +314,33 @@ class submap : maptile_soa<SEEX, SEEY>
         std::unique_ptr<basecamp> camp;  // only allowing one basecamp per submap
 
     private:
+        using tile_data = maptile_soa<SEEX, SEEY>;
+        // Per-tile data, possibly shared with other uniform submaps, see set_uniform.
+        std::shared_ptr<tile_data> soa;
+
+        // Copies shared tiles before they are written to. Only uniform submaps share their
+        // tiles, and they stop being uniform with the first write.
+        tile_data &writable_soa() {
+            unshare_tiles();
+            return *soa;
+        }
+        // For the item and field accessors, whose callers have to unshare the tiles first
+        tile_data &owned_soa() {
+            if( shares_tiles() ) {
+                report_shared_tiles();
+            }
+            return *soa;
+        }
+        // Complains about handing out shared tiles for writing, then copies them
+        void report_shared_tiles();
+
         std::map<point, computer> computers;
         std::unique_ptr<computer> legacy_computer;
         int temperature = 0;
 
+        actualize_summary actualize_summary_;
+        bool actualize_summary_dirty = true;
+
         void update_legacy_computer();
 
         static constexpr size_t elements = SEEX * SEEY;
@@ -272,6 +360,11 @@ struct maptile {
 
         maptile( submap *sub, const point &p ) :
             sm( sub ), pos_( p ) { }
+
+        // Reads go through the const submap, so they don't copy the shared tiles of uniform submaps
+        const submap &read_sm() const {
+            return *sm;
+        }
     public:
         inline point pos() const {
             return pos_;
@@ -301,10 +394,14 @@ struct maptile {
         }
 
         const field &get_field() const {
-            return sm->get_field( pos() );
+            return read_sm().get_field( pos() );
         }
 
         field_entry *find_field( const field_type_id &field_to_find ) {
+            // Shared tiles hold no fields
+            if( sm->shares_tiles() ) {
+                return nullptr;
+            }
             return sm->get_field( pos() ).find_field( field_to_find );
         }
 
@@ -330,12 +427,12 @@ struct maptile {
 
         // For map::draw_maptile
         size_t get_item_count() const {
-            return sm->get_items( pos() ).size();
+            return read_sm().get_items( pos() ).size();
         }
 
         // Assumes there is at least one item
         const item &get_uppermost_item() const {
-            return *std::prev( sm->get_items( pos() ).cend() );
+            return *std::prev( read_sm().get_items( pos() ).cend() );
         }
 };
 
@@ -1514,18 +1514,29 @@ void Character::suffer()
         }
     }
 
+    // Bionic charge timers and the cost timers of active mutations count down every turn,
+    // and are saved and shown that way, so they stay out of the upkeep schedules
     for( size_t i = 0; i < get_bionics().size(); i++ ) {
         process_bionic( i );
     }
 
-    for( const trait_id &mut_id : get_mutations() ) {
-        if( calendar::once_every( 1_minutes ) ) {
-            suffer_water_damage( mut_id );
-        }
-        if( has_active_mutation( mut_id ) ) {
-            suffer_mutation_power( mut_id );
+    if( upkeep_schedules_dirty ) {
+        schedule_upkeep( calendar::turn - 1_turns );
+    }
+    water_schedule.run_due( calendar::turn - 1_turns, calendar::turn,
+    [this]( const trait_id & mut_id, int ) {
+        suffer_water_damage( mut_id );
+    } );
+    // Only the character's own mutations can be active. Paying for one may deactivate it.
+    std::vector<trait_id> active_mutations;
+    for( const std::pair<const trait_id, trait_data> &mut : my_mutations ) {
+        if( mut.second.powered ) {
+            active_mutations.push_back( mut.first );
         }
     }
+    for( const trait_id &mut_id : active_mutations ) {
+        suffer_mutation_power( mut_id );
+    }
 
     if( underwater ) {
         suffer_while_underwater();
@@ -161,9 +161,9 @@ cata::optional<translation> snippet_library::random_from_category( const std::st
     }
     const size_t count = it->second.ids.size() + it->second.no_id.size();
     // uniform_int_distribution always returns zero when the random engine is
-    // cata_default_random_engine aka std::minstd_rand0 and the seed is small,
-    // so std::mt19937 is used instead. This engine is deterministically seeded,
-    // so acceptable.
+    // std::minstd_rand0 and the seed is small, so std::mt19937 is used. It is
+    // kept so that a seed keeps picking the same snippet. This engine is
+    // deterministically seeded, so acceptable.
     // NOLINTNEXTLINE(cata-determinism)
     std::mt19937 generator( seed );
     std::uniform_int_distribution<size_t> dis( 0, count - 1 );
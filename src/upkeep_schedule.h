@@ -0,0 +1,91 @@
+#pragma once
+#ifndef CATA_SRC_UPKEEP_SCHEDULE_H
+#define CATA_SRC_UPKEEP_SCHEDULE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "calendar.h"
+
+/**
+ * Periodic upkeep tasks, kept in a heap ordered by the turn they are next due on.
+ *
+ * A task that repeats every `period` is due on the turns that are a multiple of it, the
+ * same turns @ref calendar::once_every fires on. Running a range of turns only touches the
+ * tasks due in that range, so a turn with nothing due costs a single comparison no matter
+ * how many tasks are registered.
+ */
+template<typename Task>
+class upkeep_schedule
+{
+    public:
+        void clear() {
+            heap.clear();
+        }
+
+        bool empty() const {
+            return heap.empty();
+        }
+
+        size_t size() const {
+            return heap.size();
+        }
+
+        /** Adds a task repeating every `period` (at least one turn), first due after `now`. */
+        void add( const Task &task, const time_duration &period, const time_point &now ) {
+            const int period_turns = std::max( 1, to_turns<int>( period ) );
+            heap.push_back( entry{ next_due( now, period_turns ), period_turns, task } );
+            std::push_heap( heap.begin(), heap.end(), due_later );
+        }
+
+        /**
+         * Calls `fn( task, ticks )` for every task due at least once in the turns after `from`
+         * up to and including `to`, where `ticks` is how many times it came due in there.
+         * The tasks are rescheduled before `fn` is called, so it may add or clear tasks.
+         */
+        template<typename F>
+        void run_due( const time_point &from, const time_point &to, F fn ) {
+            if( from < last_run ) {
+                // Time went backwards, due times are no longer meaningful.
+                for( entry &e : heap ) {
+                    e.due = next_due( from, e.period );
+                }
+                std::make_heap( heap.begin(), heap.end(), due_later );
+            }
+            last_run = to;
+            const int from_turn = to_turn<int>( from );
+            const int until_turn = to_turn<int>( to );
+            while( !heap.empty() && to_turn<int>( heap.front().due ) <= until_turn ) {
+                std::pop_heap( heap.begin(), heap.end(), due_later );
+                entry &e = heap.back();
+                const int ticks = until_turn / e.period - from_turn / e.period;
+                const Task task = e.task;
+                e.due = next_due( to, e.period );
+                std::push_heap( heap.begin(), heap.end(), due_later );
+                if( ticks > 0 ) {
+                    fn( task, ticks );
+                }
+            }
+        }
+
+    private:
+        struct entry {
+            time_point due;
+            int period;
+            Task task;
+        };
+
+        static time_point next_due( const time_point &after, int period ) {
+            return time_point::from_turn( ( to_turn<int>( after ) / period + 1 ) * period );
+        }
+
+        static bool due_later( const entry &lhs, const entry &rhs ) {
+            return lhs.due > rhs.due;
+        }
+
+        std::vector<entry> heap;
+        time_point last_run = calendar::turn_zero;
+};
+
+#endif // CATA_SRC_UPKEEP_SCHEDULE_H
@@ -0,0 +1,2 @@
+// NOLINT(cata-header-guard)
+#define VERSION "5c642d2"
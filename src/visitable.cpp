@@ -588,6 +588,8 @@ std::list<item> Character::remove_items_with( const
         // nothing to do
         return res;
     }
+    invalidate_enchantment_cache();
+    invalidate_ups_item_index();
 
     // first try and remove items from the inventory
     res = inv->remove_items_with( filter, count );
@@ -644,6 +646,10 @@ std::list<item> map_cursor::remove_items_with( const
     // fetch the appropriate item stack
     point offset;
     submap *sub = here.get_submap_at( pos(), offset );
+    if( sub->shares_tiles() ) {
+        // Shared uniform tiles hold no items
+        return res;
+    }
     cata::colony<item> &stack = sub->get_items( offset );
 
     for( auto iter = stack.begin(); iter != stack.end(); ) {
@@ -686,6 +686,11 @@ input_event input_manager::get_input_event( const keyboard_mode /*preferred_keyb
         throw std::runtime_error( "input_manager::get_input_event called in test mode" );
     }
 
+    input_event requeued;
+    if( take_requeued_event( requeued ) ) {
+        return requeued;
+    }
+
     // standards note: getch is sometimes required to call refresh
     // see, e.g., http://linux.die.net/man/3/getch
     // so although it's non-obvious, that refresh() call (and maybe InvalidateRect?) IS supposed to be there
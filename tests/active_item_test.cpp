@@ -5,10 +5,12 @@
 #include "calendar.h"
 #include "catch/catch.hpp"
 #include "item.h"
+#include "item_pocket.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "optional.h"
 #include "player_helpers.h"
+#include "type_id.h"
 
 TEST_CASE( "active_items_processed_regularly", "[item]" )
 {
@@ -45,3 +47,36 @@ TEST_CASE( "active_items_processed_regularly", "[item]" )
     CHECK( player_character.weapon.charges == expected_ticks );
     CHECK( here.i_at( player_character.pos() ).only_item().charges == expected_ticks );
 }
+
+TEST_CASE( "carried_ups_charges_ups_powered_tools", "[item][ups]" )
+{
+    clear_avatar();
+    clear_map();
+    avatar &player_character = get_avatar();
+    item storage( "backpack", calendar::turn_zero );
+    REQUIRE( player_character.wear_item( storage ) );
+
+    item ups( "UPS_off" );
+    item ups_mag( ups.magazine_default() );
+    ups_mag.ammo_set( ups_mag.ammo_default(), 500 );
+    ups.put_in( ups_mag, item_pocket::pocket_type::MAGAZINE_WELL );
+    item *carried_ups = player_character.try_add( ups );
+    REQUIRE( carried_ups != nullptr );
+
+    item phone( "smart_phone" );
+    phone.ammo_set( itype_id( "battery" ), 10 );
+    item *carried_phone = player_character.try_add( phone );
+    REQUIRE( carried_phone != nullptr );
+
+    player_character.process_items();
+    CHECK( carried_phone->ammo_remaining() == 11 );
+    CHECK( carried_ups->ammo_remaining() == 499 );
+
+    // Tools picked up later are charged as well.
+    item *second_phone = player_character.try_add( phone );
+    REQUIRE( second_phone != nullptr );
+    player_character.process_items();
+    CHECK( carried_phone->ammo_remaining() == 12 );
+    CHECK( second_phone->ammo_remaining() == 11 );
+    CHECK( carried_ups->ammo_remaining() == 497 );
+}
@@ -0,0 +1,66 @@
+#include <chrono>
+
+#include "animation_timeline.h"
+#include "catch/catch.hpp"
+#include "optional.h"
+
+using anim_clock = animation_timeline::clock;
+using std::chrono::milliseconds;
+
+TEST_CASE( "animation_timeline_limits_frames_between_inputs", "[animation]" )
+{
+    animation_timeline timeline( milliseconds( 100 ) );
+    const anim_clock::time_point t0 = anim_clock::now();
+
+    SECTION( "frames are shown until the budget is spent" ) {
+        anim_clock::time_point now = t0;
+        int shown = 0;
+        for( int i = 0; i < 30; ++i ) {
+            const cata::optional<anim_clock::duration> d = timeline.frame_delay( now,
+                    milliseconds( 10 ) );
+            if( d ) {
+                CHECK( *d == milliseconds( 10 ) );
+                ++shown;
+                now += *d;
+            }
+            // Drawing the frame takes a moment on top of its delay.
+            now += milliseconds( 1 );
+        }
+        CHECK( shown == 9 );
+
+        // Waiting for the player's input starts over.
+        timeline.reset();
+        CHECK( *timeline.frame_delay( now, milliseconds( 10 ) ) == milliseconds( 10 ) );
+    }
+
+    SECTION( "a key press drops the remaining frames" ) {
+        CHECK( *timeline.frame_delay( t0, milliseconds( 10 ) ) == milliseconds( 10 ) );
+        timeline.skip();
+        CHECK( timeline.is_skipped() );
+        CHECK_FALSE( timeline.frame_delay( t0 + milliseconds( 10 ), milliseconds( 10 ) ) );
+        CHECK_FALSE( timeline.frame_delay( t0 + milliseconds( 10 ), milliseconds( 0 ) ) );
+
+        timeline.reset();
+        CHECK_FALSE( timeline.is_skipped() );
+        CHECK( *timeline.frame_delay( t0 + milliseconds( 20 ), milliseconds( 10 ) ) ==
+               milliseconds( 10 ) );
+    }
+
+    SECTION( "frames without delay are shown without waiting" ) {
+        const cata::optional<anim_clock::duration> d = timeline.frame_delay( t0, milliseconds( 0 ) );
+        REQUIRE( d );
+        CHECK( *d == anim_clock::duration::zero() );
+        // but not once the budget is spent
+        CHECK_FALSE( timeline.frame_delay( t0 + milliseconds( 101 ), milliseconds( 0 ) ) );
+    }
+
+    SECTION( "a new budget applies from the next input on" ) {
+        CHECK( timeline.frame_delay( t0, milliseconds( 10 ) ) );
+        CHECK_FALSE( timeline.frame_delay( t0 + milliseconds( 150 ), milliseconds( 10 ) ) );
+        timeline.set_budget( milliseconds( 200 ) );
+        timeline.reset();
+        CHECK( timeline.frame_delay( t0 + milliseconds( 150 ), milliseconds( 10 ) ) );
+        CHECK( timeline.frame_delay( t0 + milliseconds( 340 ), milliseconds( 10 ) ) );
+        CHECK_FALSE( timeline.frame_delay( t0 + milliseconds( 350 ), milliseconds( 10 ) ) );
+    }
+}
@@ -339,3 +339,39 @@ TEST_CASE( "suffering from sunburn", "[char][suffer][sunburn]" )
     }
 }
 
+
+// Suffering from water weakness (weakness_to_water)
+//
+// - Water hurts once per minute, on the turns calendar::once_every( 1_minutes ) fires on
+// - Each body part takes weakness_to_water times its wetness percentage in damage
+//
+TEST_CASE( "suffering from water weakness", "[char][suffer][water]" )
+{
+    clear_map();
+    avatar &dummy = get_avatar();
+    clear_character( dummy );
+    const trait_id water_weakness( "TEST_WATER_WEAKNESS" );
+    const bodypart_id torso( "torso" );
+
+    dummy.toggle_trait( water_weakness );
+    REQUIRE( dummy.has_trait( water_weakness ) );
+    dummy.set_part_wetness( torso, torso->drench_max );
+    const int hp_before = dummy.get_part_hp_cur( torso );
+
+    calendar::turn = calendar::turn_zero + 1_hours - 1_turns;
+    REQUIRE_FALSE( calendar::once_every( 1_minutes ) );
+    dummy.suffer();
+    CHECK( dummy.get_part_hp_cur( torso ) == hp_before );
+
+    calendar::turn += 1_turns;
+    REQUIRE( calendar::once_every( 1_minutes ) );
+    dummy.suffer();
+    CHECK( dummy.get_part_hp_cur( torso ) == hp_before - 10 );
+
+    // Losing the trait takes it off the schedule
+    dummy.toggle_trait( water_weakness );
+    dummy.healall( 100 );
+    calendar::turn += 1_minutes;
+    dummy.suffer();
+    CHECK( dummy.get_part_hp_cur( torso ) == dummy.get_part_hp_max( torso ) );
+}
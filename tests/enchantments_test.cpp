@@ -1,8 +1,11 @@
 #include "avatar.h"
+#include "calendar.h"
 #include "catch/catch.hpp"
 #include "field.h"
 #include "item.h"
 #include "item_location.h"
+#include "magic.h"
+#include "magic_enchantment.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "monster.h"
@@ -53,6 +56,82 @@ TEST_CASE( "worn enchantments", "[enchantments][worn][items]" )
 
 }
 
+TEST_CASE( "enchantment cache follows worn items", "[enchantments][worn][items]" )
+{
+    avatar p;
+    clear_character( p );
+
+    int str_before = p.get_str();
+
+    item &equiped_ring_strplus_one = p.i_add( item( "test_ring_strength_1" ) );
+    p.wear( item_location( *p.as_character(), &equiped_ring_strplus_one ), false );
+
+    // the next body update notices the ring without being told
+    calendar::turn += 1_turns;
+    p.update_body();
+    p.process_turn();
+    CHECK( p.get_str() == str_before + 1 );
+
+    REQUIRE( p.worn.size() == 1 );
+    REQUIRE( p.takeoff( p.worn.front() ) );
+    calendar::turn += 1_turns;
+    p.update_body();
+    p.process_turn();
+    CHECK( p.get_str() == str_before );
+}
+
+TEST_CASE( "vitamin rates follow traits granted by enchantments", "[enchantments][vitamins]" )
+{
+    const vitamin_id vitC( "vitC" );
+    const trait_id carnivore( "CARNIVORE" );
+    avatar wearer;
+    clear_character( wearer );
+    avatar mutant;
+    clear_character( mutant );
+    mutant.set_mutation( carnivore );
+
+    // The vitamins are scheduled before the ring is put on.
+    calendar::turn += 1_turns;
+    wearer.update_body();
+    mutant.update_body();
+    item &ring = wearer.i_add( item( "test_ring_carnivore" ) );
+    wearer.wear( item_location( *wearer.as_character(), &ring ), false );
+
+    wearer.vitamin_set( vitC, -100 );
+    mutant.vitamin_set( vitC, -100 );
+    const time_point from = calendar::turn;
+    calendar::turn += 2_hours;
+    wearer.update_body( from, calendar::turn );
+    mutant.update_body( from, calendar::turn );
+    CHECK( wearer.vitamin_rate( vitC ) == mutant.vitamin_rate( vitC ) );
+    CHECK( mutant.vitamin_get( vitC ) > -100 );
+    CHECK( wearer.vitamin_get( vitC ) == mutant.vitamin_get( vitC ) );
+
+    // Taking the ring off goes back to the plain rate.
+    REQUIRE( wearer.worn.size() == 1 );
+    REQUIRE( wearer.takeoff( wearer.worn.front() ) );
+    wearer.vitamin_set( vitC, -100 );
+    const time_point off = calendar::turn;
+    calendar::turn += 2_hours;
+    wearer.update_body( off, calendar::turn );
+    CHECK( wearer.vitamin_get( vitC ) < -100 );
+}
+
+TEST_CASE( "enchantment totals compare the spells too", "[enchantments]" )
+{
+    const enchantment &ench = enchantment_id( "TEST_ENCH" ).obj();
+    enchantment total;
+    total.force_add( ench );
+    enchantment same;
+    same.force_add( ench );
+    CHECK( total.same_total( same ) );
+
+    // operator== doesn't look at the spells, the cache check has to
+    same.add_hit_you( fake_spell( spell_id( "generic_blinding_spray_1" ) ) );
+    CHECK( total == same );
+    CHECK_FALSE( total.same_total( same ) );
+}
+
 TEST_CASE( "bionic enchantments", "[enchantments][bionics]" )
 {
     avatar p;
@@ -0,0 +1,101 @@
+#include <utility>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "explosion.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_iterator.h"
+#include "mapdata.h"
+#include "point.h"
+#include "rng.h"
+#include "type_id.h"
+
+static const tripoint blast_origin( 60, 60, 0 );
+
+// Blast power for which the force drops to 1 about 20 tiles away with the default factor.
+static constexpr float city_blast_power = 1300.0f;
+
+// A block of small houses with windows and furniture around the blast.
+static void build_city_block()
+{
+    clear_map_and_put_player_underground();
+    map &here = get_map();
+    for( int hx = 0; hx < 6; ++hx ) {
+        for( int hy = 0; hy < 6; ++hy ) {
+            const point corner( 30 + hx * 11, 30 + hy * 11 );
+            for( int dx = 0; dx < 8; ++dx ) {
+                for( int dy = 0; dy < 8; ++dy ) {
+                    const tripoint pt( corner + point( dx, dy ), 0 );
+                    const bool edge = dx == 0 || dy == 0 || dx == 7 || dy == 7;
+                    if( !edge ) {
+                        here.ter_set( pt, t_floor );
+                        if( ( dx + dy ) % 5 == 0 ) {
+                            here.furn_set( pt, f_table );
+                        }
+                    } else if( dx == 3 || dy == 3 ) {
+                        here.ter_set( pt, t_window );
+                    } else {
+                        here.ter_set( pt, t_wall );
+                    }
+                }
+            }
+        }
+    }
+}
+
+static std::vector<std::pair<ter_id, furn_id>> snapshot_blast_area()
+{
+    map &here = get_map();
+    std::vector<std::pair<ter_id, furn_id>> ret;
+    for( const tripoint &pt : here.points_in_radius( blast_origin, 22 ) ) {
+        ret.emplace_back( here.ter( pt ), here.furn( pt ) );
+    }
+    return ret;
+}
+
+static void city_blast()
+{
+    explosion_handler::explosion( blast_origin, city_blast_power );
+    explosion_handler::process_explosions();
+}
+
+TEST_CASE( "blast_is_deterministic_for_a_seed", "[explosion]" )
+{
+    build_city_block();
+    const std::vector<std::pair<ter_id, furn_id>> before = snapshot_blast_area();
+    rng_set_engine_seed( 4242 );
+    city_blast();
+    const std::vector<std::pair<ter_id, furn_id>> first = snapshot_blast_area();
+    CHECK( first != before );
+
+    build_city_block();
+    rng_set_engine_seed( 4242 );
+    city_blast();
+    CHECK( snapshot_blast_area() == first );
+}
+
+TEST_CASE( "blast_benchmark", "[.][explosion][benchmark]" )
+{
+    BENCHMARK_ADVANCED( "20 tile blast in a city" )( Catch::Benchmark::Chronometer meter ) {
+        build_city_block();
+        meter.measure( [] {
+            city_blast();
+        } );
+    };
+}
+
+TEST_CASE( "grenade_volley_benchmark", "[.][explosion][benchmark]" )
+{
+    build_city_block();
+    // A burst from an automatic grenade launcher, M430A1 rounds walking across the block.
+    explosion_data m430a1( 72 );
+    m430a1.shrapnel.casing_mass = 250;
+    m430a1.shrapnel.fragment_mass = 0.15f;
+    BENCHMARK( "volley of 12 grenades" ) {
+        for( int i = 0; i < 12; ++i ) {
+            explosion_handler::explosion( blast_origin + point( 3 * i - 18, i % 3 - 1 ), m430a1 );
+        }
+        explosion_handler::process_explosions();
+    };
+}
@@ -0,0 +1,157 @@
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "game_constants.h"
+#include "line.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "map_iterator.h"
+#include "mapdata.h"
+#include "point.h"
+#include "rng.h"
+
+static const tripoint viewer_pos( HALF_MAPSIZE_X, HALF_MAPSIZE_Y, 0 );
+
+static void scatter_walls( map &here, int count )
+{
+    for( int i = 0; i < count; ++i ) {
+        const tripoint p( rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 );
+        if( p != viewer_pos ) {
+            here.ter_set( p, t_wall );
+        }
+    }
+}
+
+TEST_CASE( "fov_bitmap_matches_map_sees_in_the_open", "[vision][fov_bitmap]" )
+{
+    clear_map();
+    map &here = get_map();
+    here.set_seen_cache_dirty( 0 );
+    here.build_map_cache( 0 );
+
+    const int range = 40;
+    int mismatches = 0;
+    for( const tripoint &t : here.points_in_radius( viewer_pos, range ) ) {
+        mismatches += here.sees_from_fov( viewer_pos, t, range ) != here.sees( viewer_pos, t, range );
+    }
+    CHECK( mismatches == 0 );
+}
+
+TEST_CASE( "fov_bitmap_matches_map_sees_behind_walls", "[vision][fov_bitmap]" )
+{
+    clear_map();
+    map &here = get_map();
+    // A solid wall two tiles east of the viewer, five tiles long each way.
+    for( int dy = -5; dy <= 5; ++dy ) {
+        here.ter_set( viewer_pos + point( 2, dy ), t_wall );
+    }
+    here.set_seen_cache_dirty( 0 );
+    here.build_map_cache( 0 );
+
+    const int range = 20;
+    // Straight behind the wall, and the wall itself.
+    for( int dx = 2; dx <= 10; ++dx ) {
+        const tripoint t = viewer_pos + point( dx, 0 );
+        CAPTURE( dx );
+        CHECK( here.sees_from_fov( viewer_pos, t, range ) == here.sees( viewer_pos, t, range ) );
+    }
+    // Everything west of the viewer is in the open.
+    for( int dx = -10; dx <= 0; ++dx ) {
+        for( int dy = -10; dy <= 10; ++dy ) {
+            const tripoint t = viewer_pos + point( dx, dy );
+            CAPTURE( dx, dy );
+            CHECK( here.sees_from_fov( viewer_pos, t, range ) );
+            CHECK( here.sees( viewer_pos, t, range ) );
+        }
+    }
+    // Beyond the range, nothing is seen.
+    CHECK_FALSE( here.sees_from_fov( viewer_pos, viewer_pos + point( -range - 1, 0 ), range ) );
+}
+
+TEST_CASE( "fov_bitmap_mostly_matches_map_sees_in_clutter", "[vision][fov_bitmap]" )
+{
+    clear_map();
+    map &here = get_map();
+    scatter_walls( here, 800 );
+    here.set_seen_cache_dirty( 0 );
+    here.build_map_cache( 0 );
+
+    // Shadowcasting and Bresenham lines disagree on some tiles grazing the corners of
+    // obstacles, but should agree on the vast majority.
+    const int range = 30;
+    int checked = 0;
+    int mismatches = 0;
+    for( const tripoint &t : here.points_in_radius( viewer_pos, range ) ) {
+        if( rl_dist( viewer_pos, t ) > range ) {
+            continue;
+        }
+        ++checked;
+        mismatches += here.sees_from_fov( viewer_pos, t, range ) != here.sees( viewer_pos, t, range );
+    }
+    CAPTURE( checked, mismatches );
+    CHECK( mismatches * 10 <= checked );
+}
+
+TEST_CASE( "fov_bitmap_is_shared_by_viewers_on_one_tile", "[vision][fov_bitmap]" )
+{
+    clear_map();
+    map &here = get_map();
+    here.set_seen_cache_dirty( 0 );
+    here.build_map_cache( 0 );
+
+    const uint64_t misses_before = here.get_creature_fov_cache().misses();
+    const uint64_t hits_before = here.get_creature_fov_cache().hits();
+    here.sees_from_fov( viewer_pos, viewer_pos + point( 5, 5 ), 20 );
+    here.sees_from_fov( viewer_pos, viewer_pos + point( -5, 3 ), 20 );
+    // Smaller ranges reuse the wider bitmap.
+    here.sees_from_fov( viewer_pos, viewer_pos + point( 1, 1 ), 10 );
+    CHECK( here.get_creature_fov_cache().misses() - misses_before == 1 );
+    CHECK( here.get_creature_fov_cache().hits() - hits_before == 2 );
+}
+
+TEST_CASE( "fov_bitmap_horde_benchmark", "[.][vision][fov_bitmap][benchmark]" )
+{
+    clear_map();
+    map &here = get_map();
+    scatter_walls( here, 600 );
+
+    // A horde clumped around a few tiles, each member looking at every target.
+    std::vector<tripoint> viewers;
+    for( int i = 0; i < 200; ++i ) {
+        viewers.emplace_back( viewer_pos + point( rng( -6, 6 ), rng( -6, 6 ) ) );
+    }
+    std::vector<tripoint> targets;
+    for( int i = 0; i < 20; ++i ) {
+        targets.emplace_back( viewer_pos + point( rng( -30, 30 ), rng( -30, 30 ) ) );
+    }
+    const int range = 40;
+
+    // Each iteration is one turn: caches are invalidated, then every pair is checked.
+    BENCHMARK( "pairwise map::sees" ) {
+        here.set_seen_cache_dirty( 0 );
+        here.build_map_cache( 0, true );
+        int seen = 0;
+        for( const tripoint &v : viewers ) {
+            for( const tripoint &t : targets ) {
+                seen += here.sees( v, t, range );
+            }
+        }
+        return seen;
+    };
+    BENCHMARK( "shared fov bitmaps" ) {
+        here.set_seen_cache_dirty( 0 );
+        here.build_map_cache( 0, true );
+        int seen = 0;
+        for( const tripoint &v : viewers ) {
+            for( const tripoint &t : targets ) {
+                seen += here.sees_from_fov( v, t, range );
+            }
+        }
+        return seen;
+    };
+    printf( "fov bitmaps: %llu hits, %llu misses\n",
+            static_cast<unsigned long long>( here.get_creature_fov_cache().hits() ),
+            static_cast<unsigned long long>( here.get_creature_fov_cache().misses() ) );
+}
@@ -0,0 +1,163 @@
+#include <cstdint>
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "game_constants.h"
+#include "line.h"
+#include "los_cache.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapdata.h"
+#include "point.h"
+#include "rng.h"
+
+TEST_CASE( "los_cache_insert_and_lookup", "[vision][los_cache]" )
+{
+    los_cache cache;
+    const tripoint a( 10, 20, 0 );
+    const tripoint b( 30, 40, 0 );
+    const tripoint c( 30, 40, -1 );
+
+    CHECK( cache.get( a, b ) == los_cache::result::unknown );
+    cache.insert( a, b, true );
+    cache.insert( a, c, false );
+    CHECK( cache.get( a, b ) == los_cache::result::visible );
+    // The cache is reflexive.
+    CHECK( cache.get( b, a ) == los_cache::result::visible );
+    CHECK( cache.get( c, a ) == los_cache::result::blocked );
+
+    SECTION( "clearing invalidates every entry" ) {
+        cache.clear();
+        CHECK( cache.get( a, b ) == los_cache::result::unknown );
+        CHECK( cache.get( a, c ) == los_cache::result::unknown );
+        cache.insert( a, b, false );
+        CHECK( cache.get( a, b ) == los_cache::result::blocked );
+    }
+
+    SECTION( "points outside the bubble are never cached" ) {
+        const tripoint outside( -1, 20, 0 );
+        cache.insert( outside, b, true );
+        CHECK( cache.get( outside, b ) == los_cache::result::unknown );
+        const tripoint far_outside( MAPSIZE_X + 256, 20, 0 );
+        cache.insert( far_outside, b, true );
+        CHECK( cache.get( far_outside, b ) == los_cache::result::unknown );
+    }
+
+    SECTION( "counters track hits and misses" ) {
+        cache.reset_stats();
+        cache.get( a, b );
+        cache.get( b, c );
+        CHECK( cache.hits() == 1 );
+        CHECK( cache.misses() == 1 );
+    }
+}
+
+TEST_CASE( "los_cache_survives_many_generations", "[vision][los_cache]" )
+{
+    los_cache cache;
+    const tripoint a( 1, 2, 0 );
+    const tripoint b( 3, 4, 0 );
+    cache.insert( a, b, true );
+    // Run the generation counter past its wraparound point.
+    int stale_hits = 0;
+    int lost_inserts = 0;
+    for( int i = 0; i < ( 1 << 21 ) + 5; ++i ) {
+        cache.clear();
+        stale_hits += cache.get( a, b ) != los_cache::result::unknown;
+        if( i % 4096 == 0 ) {
+            cache.insert( a, b, true );
+            lost_inserts += cache.get( a, b ) != los_cache::result::visible;
+        }
+    }
+    CHECK( stale_hits == 0 );
+    CHECK( lost_inserts == 0 );
+}
+
+// What map::sees computes on a cache miss on a single z-level, walked again without the cache.
+static bool sees_uncached( const map &here, const tripoint &from, const tripoint &to )
+{
+    bool visible = true;
+    bresenham( from.xy(), to.xy(), 0, [&]( const point & p ) {
+        // The last square is still visible even if opaque.
+        if( p == to.xy() ) {
+            return false;
+        }
+        if( !here.is_transparent( tripoint( p, to.z ) ) ) {
+            visible = false;
+            return false;
+        }
+        return true;
+    } );
+    return visible;
+}
+
+TEST_CASE( "map_sees_cache_is_consistent", "[vision][los_cache]" )
+{
+    clear_map();
+    map &here = get_map();
+    for( int i = 0; i < 400; ++i ) {
+        here.ter_set( tripoint( rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 ), t_wall );
+    }
+    // Clears the cache, as the terrain changed.
+    here.build_map_cache( 0 );
+
+    std::vector<std::pair<tripoint, tripoint>> pairs;
+    for( int i = 0; i < 500; ++i ) {
+        pairs.emplace_back( tripoint( rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 ),
+                            tripoint( rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 ) );
+    }
+    std::vector<bool> expected;
+    for( const std::pair<tripoint, tripoint> &p : pairs ) {
+        expected.push_back( sees_uncached( here, p.first, p.second ) );
+    }
+    // The first pass fills the cache, the second is answered from it, in both directions
+    // as the cache is reflexive.
+    for( size_t i = 0; i < pairs.size(); ++i ) {
+        CAPTURE( pairs[i].first, pairs[i].second );
+        CHECK( here.sees( pairs[i].first, pairs[i].second, -1 ) == expected[i] );
+    }
+    for( size_t i = 0; i < pairs.size(); ++i ) {
+        CAPTURE( pairs[i].first, pairs[i].second );
+        CHECK( here.sees( pairs[i].first, pairs[i].second, -1 ) == expected[i] );
+        CHECK( here.sees( pairs[i].second, pairs[i].first, -1 ) == expected[i] );
+    }
+}
+
+TEST_CASE( "map_sees_benchmark", "[.][vision][los_cache][benchmark]" )
+{
+    clear_map();
+    map &here = get_map();
+    for( int i = 0; i < 1000; ++i ) {
+        here.ter_set( tripoint( rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 ), t_wall );
+    }
+    here.build_map_cache( 0 );
+
+    // A horde of viewers all checking the same handful of targets, as monster::plan does.
+    std::vector<tripoint> viewers;
+    std::vector<tripoint> targets;
+    for( int i = 0; i < 200; ++i ) {
+        viewers.emplace_back( rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 );
+    }
+    for( int i = 0; i < 10; ++i ) {
+        targets.emplace_back( rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 );
+    }
+    const uint64_t hits_before = here.get_skew_vision_cache().hits();
+    const uint64_t misses_before = here.get_skew_vision_cache().misses();
+
+    BENCHMARK( "map::sees, warm cache" ) {
+        int seen = 0;
+        for( const tripoint &v : viewers ) {
+            for( const tripoint &t : targets ) {
+                seen += here.sees( v, t, 60 );
+            }
+        }
+        return seen;
+    };
+
+    const uint64_t hits = here.get_skew_vision_cache().hits() - hits_before;
+    const uint64_t misses = here.get_skew_vision_cache().misses() - misses_before;
+    printf( "los cache: %llu hits, %llu misses\n", static_cast<unsigned long long>( hits ),
+            static_cast<unsigned long long>( misses ) );
+}
@@ -1,17 +1,26 @@
 #include "catch/catch.hpp"
 #include "map.h"
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "avatar.h"
 #include "coordinates.h"
 #include "enums.h"
+#include "field_type.h"
 #include "game.h"
 #include "game_constants.h"
+#include "level_cache.h"
+#include "lightmap.h"
 #include "map_helpers.h"
 #include "point.h"
 #include "type_id.h"
+#include "units.h"
+#include "vehicle.h"
+#include "vpart_position.h"
 
 TEST_CASE( "destroy_grabbed_furniture" )
 {
@@ -93,3 +102,162 @@ TEST_CASE( "place_player_can_safely_move_multiple_submaps" )
     g->place_player( tripoint_zero );
     CHECK( get_map().check_submap_active_item_consistency().empty() );
 }
+
+TEST_CASE( "map_shift_keeps_submaps_and_vehicles_in_place" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint furn_pos( 60, 60, 0 );
+    const tripoint veh_pos( 70, 62, 0 );
+    here.furn_set( furn_pos, furn_id( "f_chair" ) );
+    vehicle *veh = here.add_vehicle( vproto_id( "bicycle" ), veh_pos, 0_degrees, 0, 0 );
+    REQUIRE( veh != nullptr );
+    const tripoint abs_sub = here.get_abs_sub();
+
+    // Walk the map around in a loop, so the grid's origin wraps in both directions.
+    const std::vector<point> steps = {
+        point_east, point_east, point_south, point_south_east, point_north_west,
+        point_north, point_north, point_west, point_west, point_south
+    };
+    point total = point_zero;
+    for( const point &step : steps ) {
+        here.shift( step );
+        total += step;
+        const point offset( -total.x * SEEX, -total.y * SEEY );
+        CAPTURE( total );
+        CHECK( here.get_abs_sub() == abs_sub + total );
+        CHECK( here.furn( furn_pos + offset ) == furn_id( "f_chair" ) );
+        const optional_vpart_position vp = here.veh_at( veh_pos + offset );
+        REQUIRE( vp );
+        CHECK( &vp->vehicle() == veh );
+        CHECK( here.get_vehicles().size() == 1 );
+    }
+    CHECK( here.check_submap_active_item_consistency().empty() );
+}
+
+TEST_CASE( "uncached_zlevels_agree_with_their_caches" )
+{
+    clear_map();
+    map &here = get_map();
+    const int deep_z = -OVERMAP_DEPTH + 1;
+    here.build_map_cache( 0, true );
+    const std::pair<int, int> cached = here.get_cached_zlevs();
+    CHECK( cached.first <= -1 );
+    CHECK( cached.second >= 1 );
+
+    // Answers for the deep level, whether or not it has caches right now.
+    const std::vector<tripoint> probes = {
+        { 5, 5, deep_z }, { 60, 60, deep_z }, { 130, 3, deep_z }
+    };
+    std::vector<std::pair<bool, float>> before;
+    for( const tripoint &p : probes ) {
+        before.emplace_back( here.is_outside( p ), here.light_transparency( p ) );
+    }
+
+    // A field on the deep level makes it get caches.
+    REQUIRE( here.add_field( tripoint( 100, 100, deep_z ), fd_smoke, 1 ) );
+    here.build_map_cache( 0, true );
+    CHECK( here.get_cached_zlevs().first <= deep_z );
+    for( size_t i = 0; i < probes.size(); ++i ) {
+        CAPTURE( probes[i] );
+        CHECK( here.is_outside( probes[i] ) == before[i].first );
+        CHECK( here.light_transparency( probes[i] ) == before[i].second );
+    }
+    clear_fields( deep_z );
+    here.process_fields();
+}
+
+TEST_CASE( "uncached_zlevels_see_changes_made_since_the_last_build" )
+{
+    clear_map();
+    map &here = get_map();
+    const int sky_z = OVERMAP_HEIGHT;
+    here.build_map_cache( 0, true );
+    if( here.get_cached_zlevs().second >= sky_z ) {
+        WARN( "the topmost z-level is cached, skipping" );
+        return;
+    }
+
+    // The level stops being uniform sky, but no cache is built for it in between.
+    const tripoint floor_pos( 60, 60, sky_z );
+    const tripoint wall_pos( 70, 60, sky_z );
+    REQUIRE( here.is_outside( floor_pos + tripoint_east ) );
+    here.ter_set( floor_pos, ter_id( "t_floor" ) );
+    here.ter_set( wall_pos, ter_id( "t_wall" ) );
+    CHECK_FALSE( here.is_outside( floor_pos ) );
+    CHECK_FALSE( here.is_outside( floor_pos + tripoint_east ) );
+    CHECK( here.is_outside( floor_pos + tripoint( 2, 0, 0 ) ) );
+    CHECK( here.light_transparency( floor_pos ) == LIGHT_TRANSPARENCY_OPEN_AIR );
+    CHECK( here.light_transparency( wall_pos ) == LIGHT_TRANSPARENCY_SOLID );
+    wipe_map_terrain();
+}
+
+TEST_CASE( "const_cache_reads_dont_allocate_caches" )
+{
+    clear_map();
+    map &here = get_map();
+    const int deep_z = -OVERMAP_DEPTH;
+    here.build_map_cache( 0, true );
+    if( here.get_cached_zlevs().first <= deep_z + 1 ) {
+        WARN( "the deepest z-levels are cached, skipping" );
+        return;
+    }
+
+    // Both levels without caches read the same shared empty one.
+    const map &const_here = here;
+    const level_cache &deepest = const_here.access_cache( deep_z );
+    CHECK( &deepest == &const_here.get_cache_ref( deep_z + 1 ) );
+    CHECK( deepest.visibility_cache[60][60] == lit_level::DARK );
+    CHECK( deepest.seen_cache[60][60] == 0.0f );
+    CHECK( deepest.vehicle_list.empty() );
+
+    // Building the caches doesn't touch it.
+    here.build_map_cache( 0, true );
+    CHECK( &const_here.access_cache( deep_z ) == &deepest );
+}
+
+TEST_CASE( "map_shift_moves_transparency_cache_along", "[map][shift]" )
+{
+    clear_map();
+    map &here = get_map();
+    // Walls scattered over the whole map, so the shifted rows and columns differ.
+    for( int i = 0; i < MAPSIZE_X; i += 5 ) {
+        here.ter_set( tripoint( i, ( i * 7 ) % MAPSIZE_Y, 0 ), ter_id( "t_wall" ) );
+        here.ter_set( tripoint( ( i * 3 ) % MAPSIZE_X, i, 0 ), ter_id( "t_wall" ) );
+    }
+    here.build_map_cache( 0, false );
+
+    int changed_x = 30;
+    for( const point &step : {
+             point_east, point_south, point_north_west, point_west, point_south_east
+         } ) {
+        CAPTURE( step );
+        // A tile changed before the shift has to be rebuilt at its shifted position.
+        here.ter_set( tripoint( changed_x, 30, 0 ), ter_id( "t_wall" ) );
+        changed_x += 2;
+        here.shift( step );
+        here.build_map_cache( 0, false );
+        std::vector<float> shifted;
+        const level_cache &ch = here.get_cache_ref( 0 );
+        std::copy( &ch.transparency_cache[0][0], &ch.transparency_cache[0][0] + MAPSIZE_X * MAPSIZE_Y,
+                   std::back_inserter( shifted ) );
+
+        here.set_transparency_cache_dirty( 0 );
+        here.build_map_cache( 0, false );
+        std::vector<float> rebuilt;
+        std::copy( &ch.transparency_cache[0][0], &ch.transparency_cache[0][0] + MAPSIZE_X * MAPSIZE_Y,
+                   std::back_inserter( rebuilt ) );
+        CHECK( shifted == rebuilt );
+    }
+}
+
+TEST_CASE( "map_shift_benchmark", "[.][benchmark]" )
+{
+    clear_map();
+    map &here = get_map();
+    BENCHMARK( "shift east and back" ) {
+        here.shift( point_east );
+        here.shift( point_west );
+        return here.get_abs_sub();
+    };
+}
@@ -0,0 +1,203 @@
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "calendar.h"
+#include "catch/catch.hpp"
+#include "coordinates.h"
+#include "field.h"
+#include "field_type.h"
+#include "game_constants.h"
+#include "item.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapbuffer.h"
+#include "mapdata.h"
+#include "point.h"
+#include "submap.h"
+#include "trap.h"
+#include "type_id.h"
+
+TEST_CASE( "submap_memory_estimate_grows_with_contents", "[submap][mapbuffer]" )
+{
+    submap sm;
+    const size_t empty = sm.estimated_memory_usage();
+    CHECK( empty >= sizeof( submap ) );
+
+    for( int i = 0; i < 10; ++i ) {
+        sm.get_items( point_zero ).insert( item( "rock", calendar::turn_zero ) );
+    }
+    CHECK( sm.estimated_memory_usage() >= empty + 10 * sizeof( item ) );
+}
+
+TEST_CASE( "mapbuffer_eviction_keeps_the_reality_bubble", "[mapbuffer]" )
+{
+    clear_map();
+    map &here = get_map();
+    const tripoint abs_sub = here.get_abs_sub();
+
+    CHECK( MAPBUFFER.resident_bytes() > 0 );
+    // A generous budget evicts nothing.
+    CHECK( MAPBUFFER.evict_to_budget( MAPBUFFER.resident_bytes() ) == 0 );
+
+    // An empty budget evicts everything outside the bubble, but nothing inside it.
+    const size_t evicted_before = MAPBUFFER.evicted_submaps();
+    const size_t evicted = MAPBUFFER.evict_to_budget( 0 );
+    CHECK( MAPBUFFER.evicted_submaps() - evicted_before == evicted );
+    for( int x = 0; x < MAPSIZE; ++x ) {
+        for( int y = 0; y < MAPSIZE; ++y ) {
+            const tripoint sm_pos = abs_sub + point( x, y );
+            CAPTURE( sm_pos );
+            CHECK( MAPBUFFER.find_resident_submap( sm_pos ) != nullptr );
+        }
+    }
+    CHECK( MAPBUFFER.resident_submaps() >= static_cast<size_t>( MAPSIZE * MAPSIZE ) );
+}
+
+TEST_CASE( "mapbuffer_evicted_submaps_reload_unchanged", "[mapbuffer]" )
+{
+    clear_map();
+    map &here = get_map();
+    // Start from a buffer holding nothing but the bubble.
+    MAPBUFFER.evict_to_budget( 0 );
+    const size_t bubble_submaps = MAPBUFFER.resident_submaps();
+
+    // A quad far outside the bubble, with some contents in each of its submaps.
+    const tripoint quad_pos = omt_to_sm_copy( sm_to_omt_copy( here.get_abs_sub() +
+                              point( MAPSIZE * 4, MAPSIZE * 4 ) ) );
+    const std::vector<point> offsets = { point_zero, point_south, point_east, point_south_east };
+    for( size_t i = 0; i < offsets.size(); ++i ) {
+        std::unique_ptr<submap> sm = std::make_unique<submap>();
+        sm->set_all_ter( t_dirt );
+        sm->set_ter( point( i, 3 ), t_rock );
+        sm->set_furn( point( 5, i ), furn_str_id( "f_chair" ) );
+        sm->get_items( point( 2, 2 ) ).insert( item( "rock", calendar::turn_zero ) );
+        REQUIRE( MAPBUFFER.add_submap( quad_pos + offsets[i], sm ) );
+    }
+    CHECK( MAPBUFFER.resident_submaps() == bubble_submaps + offsets.size() );
+
+    CHECK( MAPBUFFER.evict_to_budget( 0 ) == offsets.size() );
+    CHECK( MAPBUFFER.resident_submaps() == bubble_submaps );
+    for( const point &offset : offsets ) {
+        CHECK( MAPBUFFER.find_resident_submap( quad_pos + offset ) == nullptr );
+    }
+
+    for( size_t i = 0; i < offsets.size(); ++i ) {
+        CAPTURE( i );
+        submap *sm = MAPBUFFER.lookup_submap( quad_pos + offsets[i] );
+        REQUIRE( sm != nullptr );
+        CHECK( sm->get_ter( point( i, 3 ) ) == t_rock );
+        CHECK( sm->get_ter( point( 7, 7 ) ) == t_dirt );
+        CHECK( sm->get_furn( point( 5, i ) ) == furn_str_id( "f_chair" ) );
+        const submap &const_sm = *sm;
+        REQUIRE( const_sm.get_items( point( 2, 2 ) ).size() == 1 );
+        CHECK( const_sm.get_items( point( 2, 2 ) ).begin()->typeId() == itype_id( "rock" ) );
+    }
+    MAPBUFFER.evict_to_budget( 0 );
+}
+
+TEST_CASE( "uniform_submaps_share_tiles_until_written", "[submap][mapbuffer]" )
+{
+    submap a;
+    a.set_uniform( t_rock );
+    submap b;
+    b.set_uniform( t_rock );
+    CHECK( a.is_uniform );
+    CHECK( a.shares_tiles() );
+    CHECK( b.shares_tiles() );
+    CHECK( a.get_ter( point( 5, 7 ) ) == t_rock );
+    CHECK( a.estimated_memory_usage() * 2 < submap().estimated_memory_usage() );
+
+    // Reading through a const submap leaves the tiles shared.
+    const submap &const_a = a;
+    CHECK( const_a.get_items( point_zero ).empty() );
+    CHECK( const_a.get_field( point_zero ).field_count() == 0 );
+    CHECK( a.shares_tiles() );
+
+    // The first write gives the submap its own copy.
+    b.set_ter( point( 3, 4 ), t_dirt );
+    CHECK_FALSE( b.is_uniform );
+    CHECK_FALSE( b.shares_tiles() );
+    CHECK( b.get_ter( point( 3, 4 ) ) == t_dirt );
+    CHECK( b.get_ter( point_zero ) == t_rock );
+    CHECK( a.get_ter( point( 3, 4 ) ) == t_rock );
+}
+
+TEST_CASE( "map_reads_leave_uniform_submaps_shared", "[submap][mapbuffer]" )
+{
+    clear_map();
+    map &here = get_map();
+    MAPBUFFER.evict_to_budget( 0 );
+
+    const tripoint quad_pos = omt_to_sm_copy( sm_to_omt_copy( here.get_abs_sub() +
+                              point( MAPSIZE * 4, MAPSIZE * 4 ) ) );
+    const std::vector<point> offsets = { point_zero, point_south, point_east, point_south_east };
+    for( const point &offset : offsets ) {
+        std::unique_ptr<submap> sm = std::make_unique<submap>();
+        sm->set_uniform( t_dirt );
+        REQUIRE( MAPBUFFER.add_submap( quad_pos + offset, sm ) );
+    }
+
+    // Loading actualizes the submaps.
+    tinymap tm;
+    tm.load( tripoint_abs_sm( quad_pos ), false );
+    const tripoint p( 3, 4, quad_pos.z );
+    CHECK( tm.ter( p ) == t_dirt );
+    CHECK( tm.move_cost( p ) == 2 );
+    CHECK( tm.field_at( p ).field_count() == 0 );
+    CHECK( tm.get_field( p, fd_fire.id() ) == nullptr );
+    CHECK_FALSE( tm.has_items( p ) );
+    CHECK( tm.i_at( p ).empty() );
+
+    submap *const sm = MAPBUFFER.find_resident_submap( quad_pos );
+    REQUIRE( sm != nullptr );
+    CHECK( sm->is_uniform );
+    CHECK( sm->shares_tiles() );
+
+    // Adding an item through the stack copies the tiles. The stack keeps showing the shared
+    // tiles, which stay empty; a new one shows the item.
+    map_stack stack = tm.i_at( p );
+    stack.insert( item( "rock", calendar::turn_zero ) );
+    CHECK( stack.empty() );
+    CHECK( tm.i_at( p ).size() == 1 );
+    CHECK( tm.has_items( p ) );
+    CHECK_FALSE( sm->is_uniform );
+    CHECK_FALSE( sm->shares_tiles() );
+
+    // The other submaps still share their tiles, and adding a field copies them too.
+    const tripoint east_p = p + point( SEEX, 0 );
+    submap *const east_sm = MAPBUFFER.find_resident_submap( quad_pos + point_east );
+    REQUIRE( east_sm != nullptr );
+    CHECK( east_sm->shares_tiles() );
+    CHECK( tm.i_at( east_p ).empty() );
+    tm.i_clear( east_p );
+    CHECK( east_sm->shares_tiles() );
+    REQUIRE( tm.add_field( east_p, fd_fire, 1 ) );
+    CHECK_FALSE( east_sm->shares_tiles() );
+    CHECK( tm.get_field( east_p, fd_fire.id() ) != nullptr );
+    CHECK( tm.i_at( east_p + point_south ).empty() );
+    MAPBUFFER.evict_to_budget( 0 );
+}
+
+TEST_CASE( "submap_actualize_summary_follows_tile_changes", "[submap]" )
+{
+    submap sm;
+    sm.set_all_ter( t_dirt );
+    CHECK_FALSE( sm.get_actualize_summary().any() );
+
+    sm.set_furn( point( 4, 4 ), furn_str_id( "f_plant_seed" ) );
+    CHECK( sm.get_actualize_summary().plants );
+
+    sm.set_furn( point( 4, 4 ), f_null );
+    sm.set_radiation( point( 1, 2 ), 5 );
+    CHECK_FALSE( sm.get_actualize_summary().plants );
+    CHECK( sm.get_actualize_summary().radiation );
+
+    sm.set_radiation( point( 1, 2 ), 0 );
+    sm.set_trap( point_zero, tr_pit );
+    CHECK_FALSE( sm.get_actualize_summary().radiation );
+    CHECK( sm.get_actualize_summary().traps );
+
+    sm.set_uniform( t_rock );
+    CHECK_FALSE( sm.get_actualize_summary().any() );
+}
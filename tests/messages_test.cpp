@@ -0,0 +1,163 @@
+#include <string>
+#include <vector>
+
+#include "calendar.h"
+#include "catch/catch.hpp"
+#include "message_log.h"
+#include "output.h"
+
+static std::vector<int> ring_contents( const message_ring<int> &ring )
+{
+    std::vector<int> result;
+    for( size_t i = 0; i < ring.size(); ++i ) {
+        result.push_back( ring[i] );
+    }
+    return result;
+}
+
+TEST_CASE( "message_ring_keeps_the_newest_messages", "[messages]" )
+{
+    message_ring<int> ring;
+    CHECK( ring.empty() );
+
+    SECTION( "it wraps around past the limit" ) {
+        for( int i = 1; i <= 8; ++i ) {
+            ring.push_back( int( i ), 5 );
+        }
+        CHECK( ring.size() == 5 );
+        CHECK( ring_contents( ring ) == std::vector<int> { 4, 5, 6, 7, 8 } );
+        CHECK( ring.back() == 8 );
+    }
+
+    SECTION( "shrinking the limit drops the oldest messages" ) {
+        for( int i = 1; i <= 8; ++i ) {
+            ring.push_back( int( i ), 5 );
+        }
+        ring.push_back( 9, 3 );
+        CHECK( ring_contents( ring ) == std::vector<int> { 7, 8, 9 } );
+        ring.push_back( 10, 3 );
+        CHECK( ring_contents( ring ) == std::vector<int> { 8, 9, 10 } );
+    }
+
+    SECTION( "growing the limit keeps everything" ) {
+        for( int i = 1; i <= 4; ++i ) {
+            ring.push_back( int( i ), 3 );
+        }
+        ring.push_back( 5, 5 );
+        CHECK( ring_contents( ring ) == std::vector<int> { 2, 3, 4, 5 } );
+        ring.push_back( 6, 5 );
+        ring.push_back( 7, 5 );
+        CHECK( ring_contents( ring ) == std::vector<int> { 3, 4, 5, 6, 7 } );
+    }
+
+    SECTION( "a limit of one keeps only the last message" ) {
+        ring.push_back( 1, 1 );
+        ring.push_back( 2, 1 );
+        CHECK( ring_contents( ring ) == std::vector<int> { 2 } );
+    }
+
+    ring.clear();
+    CHECK( ring.empty() );
+}
+
+TEST_CASE( "message_texts_are_kept_while_referenced", "[messages]" )
+{
+    message_texts pool;
+    {
+        message_text a( pool, "You hear a whack!" );
+        message_text b( pool, "You hear a whack!" );
+        message_text c( pool, "You feel hungry." );
+        CHECK( a == b );
+        CHECK( a != c );
+        CHECK( pool.size() == 2 );
+        {
+            const message_text copy = a;
+            message_text moved = std::move( b );
+            CHECK( moved.str() == "You hear a whack!" );
+        }
+        // a still refers to the text
+        CHECK( pool.size() == 2 );
+        CHECK( a.str() == "You hear a whack!" );
+        a = c;
+        CHECK( pool.size() == 1 );
+        CHECK( a.str() == "You feel hungry." );
+    }
+    CHECK( pool.size() == 0 );
+}
+
+TEST_CASE( "message_cooldowns_hide_repeats_within_the_cooldown", "[messages]" )
+{
+    message_texts pool;
+    message_cooldowns cooldowns;
+    const int cooldown = 3;
+    const time_point t0 = calendar::turn_zero + 1_hours;
+    const message_text a( pool, "A" );
+    const message_text b( pool, "B" );
+
+    cooldowns.refresh( a, t0, cooldown, false );
+    // Seen once, so not hidden.
+    CHECK_FALSE( cooldowns.hides( a, t0 + 1_turns, cooldown ) );
+
+    cooldowns.refresh( a, t0 + 1_turns, cooldown, false );
+    CHECK( cooldowns.hides( a, t0 + 1_turns, cooldown ) );
+    // The message that started the cooldown stays shown.
+    CHECK_FALSE( cooldowns.hides( a, t0, cooldown ) );
+    CHECK_FALSE( cooldowns.hides( a, t0 + 4_turns, cooldown ) );
+    CHECK_FALSE( cooldowns.hides( b, t0 + 1_turns, cooldown ) );
+
+    // Messages bypassing the cooldown don't start one.
+    cooldowns.refresh( b, t0 + 2_turns, cooldown, true );
+    CHECK( cooldowns.size() == 1 );
+
+    SECTION( "elapsed cooldowns are dropped with their text" ) {
+        {
+            message_text c( pool, "C" );
+            cooldowns.refresh( c, t0 + 2_turns, cooldown, false );
+            CHECK( cooldowns.size() == 2 );
+        }
+        // The cooldown still refers to C.
+        CHECK( pool.size() == 3 );
+        cooldowns.refresh( b, t0 + 5_turns, cooldown, false );
+        CHECK( cooldowns.size() == 1 );
+        CHECK( pool.size() == 2 );
+    }
+
+    SECTION( "repeating the last message restarts its cooldown" ) {
+        cooldowns.restart( a, t0 + 2_turns );
+        cooldowns.refresh( b, t0 + 4_turns, cooldown, false );
+        CHECK( cooldowns.size() == 2 );
+        CHECK( cooldowns.hides( a, t0 + 4_turns, cooldown ) );
+    }
+}
+
+TEST_CASE( "folded_message_lines_follow_the_message", "[messages]" )
+{
+    message_texts pool;
+    int folds = 0;
+    std::string shown;
+    const auto fold = [&]( const message_text & text, const int count ) {
+        shown = text.str() + ( count > 1 ? " x " + std::to_string( count ) : "" );
+        return pool.folded( text.id(), count, 12, false, [&]() {
+            ++folds;
+            return shown;
+        } );
+    };
+
+    message_text old_text( pool, "alpha beta gamma" );
+    const message_texts::id old_id = old_text.id();
+    CHECK( fold( old_text, 1 ) == foldstring( "alpha beta gamma", 12 ) );
+    CHECK( folds == 1 );
+    fold( old_text, 1 );
+    CHECK( folds == 1 );
+
+    // A repeated message shows its new count.
+    CHECK( fold( old_text, 2 ) == foldstring( "alpha beta gamma x 2", 12 ) );
+    CHECK( folds == 2 );
+
+    // A new text reusing the id of a dropped one doesn't get its lines.
+    old_text = message_text();
+    const message_text new_text( pool, "delta epsilon" );
+    REQUIRE( new_text.id() == old_id );
+    CHECK( fold( new_text, 1 ) == foldstring( "delta epsilon", 12 ) );
+    CHECK( folds == 3 );
+}
@@ -1,7 +1,10 @@
 #include "catch/catch.hpp"
 
+#include <sstream>
+
 #include "bodypart.h"
 #include "item.h"
+#include "json.h"
 #include "morale.h"
 #include "morale_types.h"
 #include "calendar.h"
@@ -20,6 +23,38 @@ TEST_CASE( "player_morale_empty", "[player_morale]" )
     }
 }
 
+TEST_CASE( "player_morale_decay_is_saved_when_not_yet_applied", "[player_morale]" )
+{
+    player_morale m;
+    m.add( MORALE_FOOD_GOOD, 20, 40, 2_hours, 1_hours );
+
+    // Nothing changes during the first hour, so none of it is applied yet.
+    for( int i = 0; i < 60; ++i ) {
+        m.decay( 1_minutes );
+        CHECK( m.get_level() == 20 );
+    }
+
+    std::ostringstream os;
+    JsonOut jsout( os );
+    jsout.start_object();
+    m.store( jsout );
+    jsout.end_object();
+    std::istringstream is( os.str() );
+    JsonIn jsin( is );
+    player_morale loaded;
+    loaded.load( jsin.get_object() );
+
+    m.decay( 30_minutes );
+    loaded.decay( 30_minutes );
+    CHECK( m.has( MORALE_FOOD_GOOD ) < 20 );
+    CHECK( loaded.has( MORALE_FOOD_GOOD ) == m.has( MORALE_FOOD_GOOD ) );
+    CHECK( loaded.get_level() == m.get_level() );
+
+    m.decay( 30_minutes );
+    CHECK( m.has( MORALE_FOOD_GOOD ) == 0 );
+    CHECK( m.get_level() == 0 );
+}
+
 TEST_CASE( "player_morale_decay", "[player_morale]" )
 {
     player_morale m;
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <iosfwd>
 #include <memory>
 #include <set>
@@ -15,11 +16,16 @@
 #include "itype.h"
 #include "map.h"
 #include "map_helpers.h"
+#include "monster.h"
 #include "point.h"
 #include "projectile.h"
 #include "ret_val.h"
 #include "type_id.h"
+#include "units.h"
 #include "value_ptr.h"
+#include "vehicle.h"
+#include "vpart_position.h"
+#include "vpart_range.h"
 
 static tripoint projectile_end_point( const std::vector<tripoint> &range, const item &gun,
                                       int speed, int proj_range )
@@ -75,3 +81,111 @@ TEST_CASE( "projectiles_through_obstacles", "[projectile]" )
     // But that a bullet without the correct amount cannot
     CHECK( projectile_end_point( range, gun, 10, 3 ) == range[0] );
 }
+
+TEST_CASE( "projectile_volley_matches_single_shots", "[projectile]" )
+{
+    clear_map();
+    map &here = get_map();
+    get_player_character().setpos( { 2, 2, 0 } );
+
+    // A wall between the shooter and one of the targets, so the path has to go around it.
+    const tripoint source( 10, 10, 0 );
+    here.ter_set( source + tripoint( 3, 1, 0 ), ter_id( "t_wall" ) );
+    here.ter_set( source + tripoint( 3, 2, 0 ), ter_id( "t_wall" ) );
+    const std::vector<tripoint> targets = {
+        source + tripoint( 6, 1, 0 ), source + tripoint( 6, 2, 0 ), source + tripoint( -5, 4, 0 )
+    };
+
+    item gun( itype_id( "m1a" ) );
+    item mag( gun.magazine_default() );
+    mag.ammo_set( itype_id( "308" ), 5 );
+    gun.put_in( mag, item_pocket::pocket_type::MAGAZINE_WELL );
+    projectile test_proj;
+    test_proj.speed = 10;
+    test_proj.range = 10;
+    test_proj.impact = gun.gun_damage();
+    test_proj.proj_effects = gun.ammo_effects();
+    test_proj.critical_multiplier = gun.ammo_data()->ammo->critical_multiplier;
+
+    projectile_volley volley( source, nullptr );
+    for( int shot = 0; shot < 3; ++shot ) {
+        for( const tripoint &target : targets ) {
+            CAPTURE( target );
+            const dealt_projectile_attack single = projectile_attack( test_proj, source, target,
+                                                   dispersion_sources(), nullptr, nullptr );
+            const dealt_projectile_attack shared = projectile_attack( test_proj, source, target,
+                                                   dispersion_sources(), nullptr, nullptr, &volley );
+            CHECK( shared.end_point == single.end_point );
+            CHECK( volley.clear_path( here, target ) == here.find_clear_path( source, target ) );
+        }
+    }
+}
+
+TEST_CASE( "projectile_volley_from_a_vehicle_matches_single_shots", "[projectile]" )
+{
+    clear_map();
+    clear_vehicles();
+    map &here = get_map();
+    get_player_character().setpos( { 2, 2, 0 } );
+
+    vehicle *veh = here.add_vehicle( vproto_id( "meth_lab" ), tripoint( 60, 60, 0 ), 0_degrees, 0,
+                                     0 );
+    REQUIRE( veh != nullptr );
+    for( const vpart_reference &vp : veh->get_avail_parts( "OPENABLE" ) ) {
+        veh->close( vp.part_index() );
+    }
+    std::vector<tripoint> inside;
+    std::vector<tripoint> roof;
+    for( const tripoint &p : veh->get_points( true ) ) {
+        ( here.veh_at( p )->is_inside() ? inside : roof ).push_back( p );
+    }
+    REQUIRE_FALSE( inside.empty() );
+    REQUIRE_FALSE( roof.empty() );
+
+    // A turret on the roof shooting at a zombie inside the vehicle.
+    const tripoint source = roof.front();
+    const auto target_it = std::find_if( inside.begin(), inside.end(), [&]( const tripoint & p ) {
+        return here.passable( p );
+    } );
+    REQUIRE( target_it != inside.end() );
+    const tripoint target = *target_it;
+    monster &zombie = spawn_test_monster( "mon_zombie", target );
+    const int zombie_hp = zombie.get_hp();
+
+    item gun( itype_id( "m1a" ) );
+    item mag( gun.magazine_default() );
+    mag.ammo_set( itype_id( "308" ), 5 );
+    gun.put_in( mag, item_pocket::pocket_type::MAGAZINE_WELL );
+    projectile test_proj;
+    test_proj.speed = 1000;
+    test_proj.range = 30;
+    test_proj.impact = gun.gun_damage();
+    test_proj.proj_effects = gun.ammo_effects();
+    test_proj.critical_multiplier = gun.ammo_data()->ammo->critical_multiplier;
+
+    projectile_volley volley( source, veh );
+    for( int shot = 0; shot < 3; ++shot ) {
+        const dealt_projectile_attack single = projectile_attack( test_proj, source, target,
+                                               dispersion_sources(), nullptr, veh );
+        const dealt_projectile_attack shared = projectile_attack( test_proj, source, target,
+                                               dispersion_sources(), nullptr, veh, &volley );
+        CHECK( single.hit_critter == nullptr );
+        CHECK( shared.hit_critter == nullptr );
+        CHECK( shared.end_point == single.end_point );
+    }
+    CHECK( zombie.get_hp() == zombie_hp );
+
+    for( const tripoint &p : inside ) {
+        CAPTURE( p );
+        CHECK( volley.is_own_vehicle( here, p ) );
+        CHECK( volley.is_inside_own_vehicle( here, p ) );
+    }
+    for( const tripoint &p : roof ) {
+        CAPTURE( p );
+        CHECK( volley.is_own_vehicle( here, p ) );
+        CHECK_FALSE( volley.is_inside_own_vehicle( here, p ) );
+    }
+    CHECK_FALSE( volley.is_own_vehicle( here, tripoint( 50, 50, 0 ) ) );
+
+    clear_vehicles();
+}
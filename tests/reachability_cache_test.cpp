@@ -5,6 +5,8 @@
 
 #include "cached_options.h"
 #include "catch/catch.hpp"
+#include "enums.h"
+#include "game_constants.h"
 #include "map.h"
 #include "map_helpers.h"
 #include "map_iterator.h"
@@ -13,6 +15,7 @@
 #include "optional.h"
 #include "options_helpers.h"
 #include "point.h"
+#include "rng.h"
 
 using namespace map_test_case_common;
 using namespace map_test_case_common::tiles;
@@ -110,3 +113,92 @@ TEST_CASE( "reachability_vertical", "[map][cache][vision][los][reachability]" )
         }
     }, /*up*/ true );
 }
+
+// Rows of small houses with a door on every side, covering most of the reality bubble.
+static std::vector<tripoint> build_town()
+{
+    clear_map();
+    map &here = get_map();
+    std::vector<tripoint> doors;
+    for( int hx = 2; hx + 9 < MAPSIZE_X; hx += 11 ) {
+        for( int hy = 2; hy + 9 < MAPSIZE_Y; hy += 11 ) {
+            for( int dx = 0; dx < 8; ++dx ) {
+                for( int dy = 0; dy < 8; ++dy ) {
+                    if( dx != 0 && dy != 0 && dx != 7 && dy != 7 ) {
+                        continue;
+                    }
+                    const tripoint pt( hx + dx, hy + dy, 0 );
+                    if( dx == 3 || dy == 4 ) {
+                        here.ter_set( pt, t_door_c );
+                        doors.push_back( pt );
+                    } else {
+                        here.ter_set( pt, t_wall );
+                    }
+                }
+            }
+        }
+    }
+    here.set_transparency_cache_dirty( 0 );
+    here.build_map_cache( 0, true );
+    return doors;
+}
+
+static void toggle_doors( const std::vector<tripoint> &doors, int count )
+{
+    map &here = get_map();
+    for( int i = 0; i < count; ++i ) {
+        const tripoint &door = random_entry( doors );
+        here.ter_set( door, here.ter( door ) == t_door_c ? t_door_o : t_door_c );
+    }
+}
+
+static std::vector<int> reachability_snapshot()
+{
+    const map &here = get_map();
+    std::vector<int> ret;
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            for( int q = 0; q < enum_traits<reachability_cache_quadrant>::size; ++q ) {
+                const reachability_cache_quadrant quad = static_cast<reachability_cache_quadrant>( q );
+                ret.push_back( here.reachability_cache_value( { x, y, 0 }, false, quad ) );
+                ret.push_back( here.reachability_cache_value( { x, y, 0 }, true, quad ) );
+            }
+        }
+    }
+    return ret;
+}
+
+TEST_CASE( "reachability_incremental_rebuild_matches_full", "[map][cache][los][reachability]" )
+{
+    const std::vector<tripoint> doors = build_town();
+    map &here = get_map();
+    for( int round = 0; round < 5; ++round ) {
+        CAPTURE( round );
+        toggle_doors( doors, 1 + round * 7 );
+        here.build_map_cache( 0, true );
+        const std::vector<int> incremental = reachability_snapshot();
+
+        here.set_transparency_cache_dirty( 0 );
+        here.build_map_cache( 0, true );
+        CHECK( reachability_snapshot() == incremental );
+    }
+}
+
+TEST_CASE( "reachability_door_toggle_benchmark", "[.][map][cache][reachability][benchmark]" )
+{
+    const std::vector<tripoint> doors = build_town();
+    map &here = get_map();
+    const tripoint from( HALF_MAPSIZE_X, HALF_MAPSIZE_Y, 0 );
+    // The reachability caches are rebuilt lazily, by the first LOS check.
+    BENCHMARK( "toggle 4 doors, rebuild the dirty tiles" ) {
+        toggle_doors( doors, 4 );
+        here.build_map_cache( 0, true );
+        return here.has_potential_los( from, from + point_east );
+    };
+    BENCHMARK( "toggle 4 doors, rebuild the whole level" ) {
+        toggle_doors( doors, 4 );
+        here.set_transparency_cache_dirty( 0 );
+        here.build_map_cache( 0, true );
+        return here.has_potential_los( from, from + point_east );
+    };
+}
@@ -1,3 +1,4 @@
+#include <climits>
 #include <functional>
 #include <vector>
 
@@ -66,6 +67,62 @@ TEST_CASE( "x_in_y_distribution" )
     }
 }
 
+TEST_CASE( "rng_stays_within_bounds", "[rng]" )
+{
+    for( int i = 0; i < 1000; ++i ) {
+        const int small = rng( 3, -2 );
+        CHECK( small >= -2 );
+        CHECK( small <= 3 );
+        CHECK( rng( 7, 7 ) == 7 );
+        const double f = rng_float( 0.5, 1.5 );
+        CHECK( f >= 0.5 );
+        CHECK( f < 1.5 );
+    }
+    // The full range must not overflow.
+    bool seen_negative = false;
+    bool seen_positive = false;
+    for( int i = 0; i < 100; ++i ) {
+        const int any = rng( INT_MIN, INT_MAX );
+        seen_negative |= any < 0;
+        seen_positive |= any > 0;
+    }
+    CHECK( seen_negative );
+    CHECK( seen_positive );
+}
+
+static std::vector<int> mapgen_rolls()
+{
+    const rng_stream_scope scope( rng_stream::mapgen );
+    std::vector<int> rolls;
+    for( int i = 0; i < 20; ++i ) {
+        rolls.push_back( rng( 0, 1000 ) );
+    }
+    return rolls;
+}
+
+TEST_CASE( "rng_streams_do_not_shift_each_other", "[rng]" )
+{
+    rng_set_engine_seed( 1234 );
+    const int first_main = rng( 0, 1000000 );
+    const std::vector<int> first_mapgen = mapgen_rolls();
+
+    // Extra rolls on the main stream leave the mapgen stream alone.
+    rng_set_engine_seed( 1234 );
+    CHECK( rng( 0, 1000000 ) == first_main );
+    for( int i = 0; i < 7; ++i ) {
+        rng( 0, 10 );
+    }
+    CHECK( mapgen_rolls() == first_mapgen );
+
+    // And the streams are not copies of each other.
+    rng_set_engine_seed( 1234 );
+    std::vector<int> main_rolls;
+    for( int i = 0; i < 20; ++i ) {
+        main_rolls.push_back( rng( 0, 1000 ) );
+    }
+    CHECK( main_rolls != first_mapgen );
+}
+
 TEST_CASE( "random_entry_preserves_constness" )
 {
     const std::vector<int> v0{ 4321 };
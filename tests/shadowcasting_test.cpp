@@ -344,11 +344,11 @@ static void do_3d_benchmark(
     const int iterations )
 {
     float seen_squares[OVERMAP_LAYERS][MAPSIZE * SEEX][MAPSIZE * SEEY] = {};
-    bool floor_cache[OVERMAP_LAYERS][MAPSIZE * SEEX][MAPSIZE * SEEY] = {};
+    std::array<bitset_grid, OVERMAP_LAYERS> floor_cache = {};
 
     const tripoint origin( 65, 65, 0 );
     std::array<float ( * )[MAPSIZE *SEEX][MAPSIZE *SEEY], OVERMAP_LAYERS> seen_caches;
-    std::array<const bool ( * )[MAPSIZE *SEEX][MAPSIZE *SEEY], OVERMAP_LAYERS> floor_caches;
+    array_of_bitset_grids floor_caches;
 
     for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
         seen_caches[z + OVERMAP_DEPTH] = &seen_squares[z + OVERMAP_DEPTH];
@@ -415,7 +415,7 @@ static void shadowcasting_3d_2d( const int iterations )
     float seen_squares_control[MAPSIZE * SEEX][MAPSIZE * SEEY] = {};
     float seen_squares_experiment[MAPSIZE * SEEX][MAPSIZE * SEEY] = {};
     float transparency_cache[MAPSIZE * SEEX][MAPSIZE * SEEY] = {};
-    bool floor_cache[MAPSIZE * SEEX][MAPSIZE * SEEY] = {};
+    bitset_grid floor_cache = {};
 
     randomly_fill_transparency( transparency_cache );
 
@@ -434,7 +434,7 @@ static void shadowcasting_3d_2d( const int iterations )
     const tripoint origin( offset );
     std::array<const float ( * )[MAPSIZE *SEEX][MAPSIZE *SEEY], OVERMAP_LAYERS> transparency_caches;
     std::array<float ( * )[MAPSIZE *SEEX][MAPSIZE *SEEY], OVERMAP_LAYERS> seen_caches;
-    std::array<const bool ( * )[MAPSIZE *SEEX][MAPSIZE *SEEY], OVERMAP_LAYERS> floor_caches;
+    array_of_bitset_grids floor_caches;
     for( int z = -OVERMAP_DEPTH; z <= OVERMAP_HEIGHT; z++ ) {
         // TODO: Give some more proper values here
         transparency_caches[z + OVERMAP_DEPTH] = &transparency_cache;
@@ -546,7 +546,7 @@ static void run_spot_check( const grid_overlay &test_case, const grid_overlay &e
     level_cache *caches[OVERMAP_LAYERS];
     std::array<float ( * )[MAPSIZE *SEEX][MAPSIZE *SEEY], OVERMAP_LAYERS> seen_squares;
     std::array<const float ( * )[MAPSIZE *SEEX][MAPSIZE *SEEY], OVERMAP_LAYERS> transparency_cache;
-    std::array<const bool ( * )[MAPSIZE *SEEX][MAPSIZE *SEEY], OVERMAP_LAYERS> floor_cache;
+    array_of_bitset_grids floor_cache;
 
     const int upper_bound = fov_3d ? OVERMAP_LAYERS : 12;
     const int lower_bound = fov_3d ? 0 : 11;
@@ -1109,3 +1109,34 @@ TEST_CASE( "bresenham_vs_shadowcasting", "[.]" )
 {
     shadowcasting_runoff( 1, true );
 }
+
+TEST_CASE( "shadowcasting_max_radius_clips_without_changing_values", "[shadowcasting]" )
+{
+    float seen_squares_full[MAPSIZE * SEEX][MAPSIZE * SEEY] = {};
+    float seen_squares_clipped[MAPSIZE * SEEX][MAPSIZE * SEEY] = {};
+    float transparency_cache[MAPSIZE * SEEX][MAPSIZE * SEEY] = {};
+
+    randomly_fill_transparency( transparency_cache );
+
+    const point offset( 65, 65 );
+    const int max_radius = 12;
+    castLightAll<float, float, sight_calc, sight_check, update_light, accumulate_transparency>(
+        seen_squares_full, transparency_cache, offset );
+    castLightAll<float, float, sight_calc, sight_check, update_light, accumulate_transparency>(
+        seen_squares_clipped, transparency_cache, offset, 0, VISIBILITY_FULL, max_radius );
+
+    int inside_mismatches = 0;
+    int outside_written = 0;
+    for( int x = 0; x < MAPSIZE * SEEX; ++x ) {
+        for( int y = 0; y < MAPSIZE * SEEY; ++y ) {
+            const point p( x, y );
+            if( std::max( std::abs( p.x - offset.x ), std::abs( p.y - offset.y ) ) <= max_radius ) {
+                inside_mismatches += seen_squares_full[x][y] != seen_squares_clipped[x][y];
+            } else {
+                outside_written += seen_squares_clipped[x][y] != 0.0f;
+            }
+        }
+    }
+    CHECK( inside_mismatches == 0 );
+    CHECK( outside_written == 0 );
+}
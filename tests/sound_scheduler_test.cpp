@@ -0,0 +1,74 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "catch/catch.hpp"
+#include "rng.h"
+#include "sound_scheduler.h"
+
+using sound_clock = sound_scheduler<std::string>::clock;
+using std::chrono::milliseconds;
+
+TEST_CASE( "sound_scheduler_plays_sounds_in_start_order", "[sounds]" )
+{
+    sound_scheduler<std::string> scheduler;
+    const sound_clock::time_point t0 = sound_clock::now();
+
+    // A flurry of melee attacks: each swing right away, its hit a weapon dependent delay later.
+    std::vector<std::pair<sound_clock::time_point, std::string>> expected;
+    for( int i = 0; i < 20; ++i ) {
+        const sound_clock::time_point swing = t0 + milliseconds( 30 * i + rng( 1, 2 ) );
+        const sound_clock::time_point hit = swing + milliseconds( rng( 40, 160 ) );
+        scheduler.schedule( hit, "hit " + std::to_string( i ) );
+        scheduler.schedule( swing, "swing " + std::to_string( i ) );
+        expected.emplace_back( swing, "swing " + std::to_string( i ) );
+        expected.emplace_back( hit, "hit " + std::to_string( i ) );
+    }
+    // Layered sounds starting together keep the order they were scheduled in.
+    for( int i = 0; i < 3; ++i ) {
+        scheduler.schedule( t0 + milliseconds( 100 ), "layer " + std::to_string( i ) );
+        expected.emplace_back( t0 + milliseconds( 100 ), "layer " + std::to_string( i ) );
+    }
+    std::stable_sort( expected.begin(), expected.end(),
+    []( const std::pair<sound_clock::time_point, std::string> &lhs,
+    const std::pair<sound_clock::time_point, std::string> &rhs ) {
+        return lhs.first < rhs.first;
+    } );
+    REQUIRE( scheduler.size() == expected.size() );
+
+    // Drain it the way the main loop does, in frames of about 16ms, without real audio output.
+    std::vector<std::pair<sound_clock::time_point, std::string>> played;
+    for( sound_clock::time_point now = t0; !scheduler.empty(); now += milliseconds( 16 ) ) {
+        scheduler.play_due( now, [&]( const std::string & snd,
+        const sound_clock::time_point & start ) {
+            // Nothing starts early, or more than a frame late.
+            CHECK( start <= now );
+            CHECK( now - start < milliseconds( 16 ) );
+            played.emplace_back( start, snd );
+        } );
+    }
+    CHECK( played.size() == expected.size() );
+    // Swings and hits of the same attack were interleaved differently in scheduling, only the
+    // start times decide the order.
+    std::vector<std::pair<sound_clock::time_point, std::string>> played_sorted = played;
+    std::stable_sort( played_sorted.begin(), played_sorted.end(),
+    []( const std::pair<sound_clock::time_point, std::string> &lhs,
+    const std::pair<sound_clock::time_point, std::string> &rhs ) {
+        return lhs.first < rhs.first;
+    } );
+    CHECK( played == played_sorted );
+    for( size_t i = 0; i < played.size(); ++i ) {
+        CHECK( played[i].first == expected[i].first );
+    }
+    const auto layer_pos = [&]( const std::string & name ) {
+        return std::find_if( played.begin(), played.end(),
+        [&]( const std::pair<sound_clock::time_point, std::string> &p ) {
+            return p.second == name;
+        } ) - played.begin();
+    };
+    CHECK( layer_pos( "layer 0" ) < layer_pos( "layer 1" ) );
+    CHECK( layer_pos( "layer 1" ) < layer_pos( "layer 2" ) );
+}
@@ -55,6 +55,43 @@ TEST_CASE( "stats_tracker_count_events", "[stats]" )
     CHECK( s.get_events( event_type::character_kills_monster ).count( char_is_player ) == 2 );
 }
 
+TEST_CASE( "events_made_from_spec_match_their_map_form", "[stats]" )
+{
+    const character_id u_id = get_player_character().getID();
+    const mtype_id mon( "mon_zombie" );
+    const cata::event made = cata::event::make<event_type::character_kills_monster>( u_id, mon );
+    cata::event::data_type data{
+        { "killer", cata_variant( u_id ) },
+        { "victim_type", cata_variant( mon ) },
+    };
+    const cata::event from_map( made.type(), made.time(), cata::event::data_type( data ) );
+
+    CHECK( made.from_spec() );
+    CHECK_FALSE( from_map.from_spec() );
+    CHECK( made.data() == data );
+    CHECK( made.get<character_id>( "killer" ) == u_id );
+    CHECK( made.get_variant_or_void( "victim_type" ) == from_map.get_variant( "victim_type" ) );
+    CHECK( made.get_variant_or_void( "no_such_field" ) == cata_variant() );
+    REQUIRE( made.find( "killer" ) != nullptr );
+    CHECK( *made.find( "killer" ) == *from_map.find( "killer" ) );
+    CHECK( made.find( "no_such_field" ) == nullptr );
+    CHECK( from_map.find( "no_such_field" ) == nullptr );
+
+    // Both forms end up in the same summary.
+    event_multiset events( made.type() );
+    events.add( made );
+    events.add( from_map );
+    events.add( made );
+    CHECK( events.counts().size() == 1 );
+    CHECK( events.count( data ) == 3 );
+
+    // A copy keeps counting into its own summaries.
+    event_multiset copy = events;
+    copy.add( made );
+    CHECK( copy.count( data ) == 4 );
+    CHECK( events.count( data ) == 3 );
+}
+
 TEST_CASE( "stats_tracker_total_events", "[stats]" )
 {
     stats_tracker s;
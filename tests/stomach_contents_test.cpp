@@ -85,6 +85,41 @@ static void eat_all_nutrients( player &p )
     p.consume( f );
 }
 
+// The fast-forward mode updates the body once per minute over the whole range instead of
+// every turn, which should end up in (nearly) the same place.
+TEST_CASE( "needs_advance_alike_per_turn_and_per_minute", "[hunger]" )
+{
+    Character &dummy = get_player_character();
+    reset_time();
+    dummy.set_thirst( 0 );
+    dummy.set_fatigue( 0 );
+    dummy.update_body();
+    pass_time( dummy, 2_hours );
+    const int hunger = dummy.get_hunger();
+    const int thirst = dummy.get_thirst();
+    const int fatigue = dummy.get_fatigue();
+    const int kcal = dummy.get_stored_kcal();
+
+    reset_time();
+    dummy.set_thirst( 0 );
+    dummy.set_fatigue( 0 );
+    dummy.update_body();
+    time_point updated = calendar::turn;
+    for( time_duration turns = 1_turns; turns < 2_hours; turns += 1_turns ) {
+        calendar::turn += 1_turns;
+        if( calendar::once_every( 1_minutes ) ) {
+            dummy.update_body( updated, calendar::turn );
+            updated = calendar::turn;
+        }
+    }
+    dummy.update_body( updated, calendar::turn );
+
+    CHECK( dummy.get_hunger() == Approx( hunger ).margin( 2 ) );
+    CHECK( dummy.get_thirst() == Approx( thirst ).margin( 2 ) );
+    CHECK( dummy.get_fatigue() == Approx( fatigue ).margin( 2 ) );
+    CHECK( dummy.get_stored_kcal() == Approx( kcal ).margin( 5 ) );
+}
+
 // how long does it take to starve to death
 // player does not thirst or tire or require vitamins
 TEST_CASE( "starve_test", "[starve][slow]" )
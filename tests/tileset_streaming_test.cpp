@@ -0,0 +1,80 @@
+#if defined(TILES)
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "cata_tiles.h"
+#include "catch/catch.hpp"
+#include "options.h"
+#include "sdl_utils.h"
+#include "sdl_wrappers.h"
+
+static const std::string test_tileset( "ASCIITiles" );
+
+// Renders every sprite of the tileset on its own and returns the resulting pixels.
+static std::vector<std::vector<Uint32>> render_sprites( const tileset &ts,
+                                     const SDL_Renderer_Ptr &renderer )
+{
+    std::vector<std::vector<Uint32>> ret;
+    for( size_t i = 0; i < ts.get_sprite_count(); ++i ) {
+        const texture *tex = ts.get_tile( i );
+        REQUIRE( tex != nullptr );
+        int width = 0;
+        int height = 0;
+        std::tie( width, height ) = tex->dimension();
+        std::vector<Uint32> pixels( static_cast<size_t>( width ) * height );
+        if( !pixels.empty() ) {
+            SDL_SetRenderDrawColor( renderer.get(), 0, 0, 0, 0 );
+            SDL_RenderClear( renderer.get() );
+            const SDL_Rect rect{ 0, 0, width, height };
+            tex->render_copy_ex( renderer, &rect, 0, nullptr, SDL_FLIP_NONE );
+            REQUIRE( SDL_RenderReadPixels( renderer.get(), &rect, SDL_PIXELFORMAT_ARGB8888,
+                                           pixels.data(), width * sizeof( Uint32 ) ) == 0 );
+        }
+        ret.push_back( pixels );
+    }
+    return ret;
+}
+
+TEST_CASE( "streamed_tileset_matches_eager_load", "[tileset]" )
+{
+    if( TILESETS.find( test_tileset ) == TILESETS.end() ) {
+        WARN( "tileset " << test_tileset << " not found, skipping" );
+        return;
+    }
+    const SDL_Surface_Ptr target = create_surface_32( 256, 256 );
+    REQUIRE( target );
+    const SDL_Renderer_Ptr renderer( SDL_CreateSoftwareRenderer( target.get() ) );
+    REQUIRE( renderer );
+
+    tileset eager;
+    tileset_loader( eager, renderer ).load( test_tileset, /*precheck=*/false );
+
+    tileset streamed;
+    tileset_loader loader( streamed, renderer );
+    loader.load( test_tileset, /*precheck=*/false, /*pump_events=*/false, /*stream=*/true );
+    REQUIRE_FALSE( loader.done() );
+    REQUIRE( streamed.get_sprite_count() == eager.get_sprite_count() );
+    // Before anything is decoded, sprites are drawn as the placeholder.
+    const texture *placeholder = streamed.get_tile( 0 );
+    REQUIRE( placeholder != nullptr );
+    CHECK( placeholder->dimension() ==
+           std::make_pair( streamed.get_tile_width(), streamed.get_tile_height() ) );
+    CHECK( streamed.get_shadow_tile( 0 ) == nullptr );
+
+    int chunks = 0;
+    while( loader.load_next_chunk() ) {
+        ++chunks;
+    }
+    CHECK( loader.done() );
+    CHECK( chunks > 1 );
+
+    CHECK( render_sprites( streamed, renderer ) == render_sprites( eager, renderer ) );
+    CHECK( streamed.get_shadow_tile( 0 ) != nullptr );
+}
+
+#endif // TILES
@@ -0,0 +1,105 @@
+#include <cstring>
+#include <memory>
+
+#include "catch/catch.hpp"
+#include "field_type.h"
+#include "game_constants.h"
+#include "level_cache.h"
+#include "map.h"
+#include "map_helpers.h"
+#include "mapdata.h"
+#include "point.h"
+#include "rng.h"
+
+struct transparency_snapshot {
+    float transparency[MAPSIZE_X][MAPSIZE_Y];
+    float vision_transparency[MAPSIZE_X][MAPSIZE_Y];
+};
+
+static std::unique_ptr<transparency_snapshot> take_snapshot( const map &here )
+{
+    std::unique_ptr<transparency_snapshot> ret = std::make_unique<transparency_snapshot>();
+    const level_cache &ch = here.get_cache_ref( 0 );
+    memcpy( &ret->transparency, &ch.transparency_cache, sizeof( ret->transparency ) );
+    memcpy( &ret->vision_transparency, &ch.vision_transparency_cache,
+            sizeof( ret->vision_transparency ) );
+    return ret;
+}
+
+static int count_mismatches( const float ( &a )[MAPSIZE_X][MAPSIZE_Y],
+                             const float ( &b )[MAPSIZE_X][MAPSIZE_Y] )
+{
+    int mismatches = 0;
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            mismatches += a[x][y] != b[x][y];
+        }
+    }
+    return mismatches;
+}
+
+TEST_CASE( "transparency_cache_rebuilds_single_tiles", "[map][cache][vision]" )
+{
+    clear_map();
+    map &here = get_map();
+    here.build_map_cache( 0, true );
+    const level_cache &ch = here.get_cache_ref( 0 );
+    CHECK_FALSE( ch.transparency_dirty() );
+
+    // Walls going up and fields drifting in only mark their own tiles dirty.
+    for( int i = 0; i < 40; ++i ) {
+        here.ter_set( tripoint( rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 ), t_wall );
+        here.add_field( tripoint( rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 ), fd_smoke, 3 );
+    }
+    CHECK( ch.transparency_cache_dirty.none() );
+    CHECK( ch.transparency_dirty() );
+    here.build_map_cache( 0, true );
+    CHECK_FALSE( ch.transparency_dirty() );
+    const std::unique_ptr<transparency_snapshot> incremental = take_snapshot( here );
+
+    // A full rebuild must agree with the incremental one.
+    here.set_transparency_cache_dirty( 0 );
+    here.build_map_cache( 0, true );
+    const std::unique_ptr<transparency_snapshot> full = take_snapshot( here );
+    CHECK( count_mismatches( incremental->transparency, full->transparency ) == 0 );
+    CHECK( count_mismatches( incremental->vision_transparency, full->vision_transparency ) == 0 );
+
+    // Removing the walls again is picked up as well.
+    for( int x = 0; x < MAPSIZE_X; ++x ) {
+        for( int y = 0; y < MAPSIZE_Y; ++y ) {
+            if( here.ter( tripoint( x, y, 0 ) ) == t_wall ) {
+                here.ter_set( tripoint( x, y, 0 ), t_dirt );
+            }
+        }
+    }
+    here.build_map_cache( 0, true );
+    const std::unique_ptr<transparency_snapshot> cleared = take_snapshot( here );
+    here.set_transparency_cache_dirty( 0 );
+    here.build_map_cache( 0, true );
+    const std::unique_ptr<transparency_snapshot> cleared_full = take_snapshot( here );
+    CHECK( count_mismatches( cleared->transparency, cleared_full->transparency ) == 0 );
+    CHECK( count_mismatches( cleared->vision_transparency, cleared_full->vision_transparency ) == 0 );
+}
+
+TEST_CASE( "build_map_cache_benchmark", "[.][map][cache][benchmark]" )
+{
+    clear_map();
+    map &here = get_map();
+    for( int i = 0; i < 800; ++i ) {
+        here.ter_set( tripoint( rng( 0, MAPSIZE_X - 1 ), rng( 0, MAPSIZE_Y - 1 ), 0 ), t_wall );
+    }
+    here.build_map_cache( 0, true );
+
+    BENCHMARK( "rebuild every cache" ) {
+        here.set_transparency_cache_dirty( 0 );
+        here.set_outside_cache_dirty( 0 );
+        here.set_seen_cache_dirty( 0 );
+        here.build_map_cache( 0, true );
+        return here.get_cache_ref( 0 ).seen_cache[HALF_MAPSIZE_X][HALF_MAPSIZE_Y];
+    };
+    BENCHMARK( "rebuild lighting and vision" ) {
+        here.set_seen_cache_dirty( 0 );
+        here.build_map_cache( 0, true );
+        return here.get_cache_ref( 0 ).seen_cache[HALF_MAPSIZE_X][HALF_MAPSIZE_Y];
+    };
+}
@@ -0,0 +1,48 @@
+#include <map>
+
+#include "calendar.h"
+#include "catch/catch.hpp"
+#include "rng.h"
+#include "upkeep_schedule.h"
+
+static int ticks_in( const time_point &from, const time_point &to, int period )
+{
+    return to_turn<int>( to ) / period - to_turn<int>( from ) / period;
+}
+
+TEST_CASE( "upkeep_schedule_matches_once_every", "[upkeep_schedule]" )
+{
+    const std::map<int, int> periods = { { 0, 1 }, { 1, 7 }, { 2, 60 }, { 3, 300 }, { 4, 1800 } };
+    const time_point start = calendar::turn_zero + 1_days;
+
+    upkeep_schedule<int> schedule;
+    for( const std::pair<const int, int> &p : periods ) {
+        schedule.add( p.first, time_duration::from_turns( p.second ), start );
+    }
+    REQUIRE( schedule.size() == periods.size() );
+
+    std::map<int, int> scheduled;
+    std::map<int, int> expected;
+    time_point now = start;
+    for( int i = 0; i < 2000; ++i ) {
+        // Mostly single turns, with the odd fast-forwarded stretch in between.
+        const time_point next = now + time_duration::from_turns( one_in( 20 ) ? rng( 2, 900 ) : 1 );
+        schedule.run_due( now, next, [&]( int task, int ticks ) {
+            scheduled[task] += ticks;
+        } );
+        for( const std::pair<const int, int> &p : periods ) {
+            expected[p.first] += ticks_in( now, next, p.second );
+        }
+        now = next;
+    }
+    CHECK( scheduled == expected );
+
+    // Going back in time, as tests do, reschedules everything.
+    scheduled.clear();
+    schedule.run_due( start, start + 1_hours, [&]( int task, int ticks ) {
+        scheduled[task] += ticks;
+    } );
+    CHECK( scheduled[0] == 3600 );
+    CHECK( scheduled[2] == 60 );
+    CHECK( scheduled[4] == 2 );
+}